@@ -0,0 +1,214 @@
+ /******************************************************************************
+ *
+ * Module: BootProfile
+ *
+ * File Name: BootProfile.c
+ *
+ * Description: Source file for the boot time profiler
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "BootProfile.h"
+#include "Startup.h"
+#include "Rtt.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define BOOTPROFILE_DEMCR_TRCENA_MASK        0x01000000u
+#define BOOTPROFILE_DWT_CTRL_CYCCNTENA_MASK  0x00000001u
+
+/* Longest line: name, two numbers of up to 10 digits and the separators */
+#define BOOTPROFILE_LINE_SIZE                64u
+#define BOOTPROFILE_NAME_WIDTH               20u
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Cycles since the reset at every boot point */
+static uint32 g_BootProfile_Cycles[BOOTPROFILE_POINTS_NUM];
+
+/* Printable point names, must follow the order of BootProfile_PointType */
+static const char * const g_BootProfile_Names[BOOTPROFILE_POINTS_NUM] =
+{
+    "main_entry",
+    "debug_ready",
+    "reset_cause_checked",
+    "mpu_ready",
+    "portf_ready",
+    "delay_ready",
+    "systick_ready",
+    "steady_state"
+};
+
+/* Printable startup phase names, must follow the order of Startup_PhaseType */
+static const char * const g_BootProfile_StartupNames[STARTUP_PHASES_NUM] =
+{
+    "startup_fpu",
+    "startup_data",
+    "startup_bss",
+    "startup_main"
+};
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+static uint8 BootProfile_AppendString(char *Line_Ptr, uint8 Length, const char *String_Ptr, uint8 Width)
+{
+    while (*String_Ptr != '\0' && Length < BOOTPROFILE_LINE_SIZE - 1)
+    {
+        Line_Ptr[Length++] = *String_Ptr++;
+        Width = (Width > 0) ? (uint8)(Width - 1) : 0;
+    }
+    while (Width > 0 && Length < BOOTPROFILE_LINE_SIZE - 1)
+    {
+        Line_Ptr[Length++] = ' ';
+        Width--;
+    }
+    return Length;
+}
+
+static uint8 BootProfile_AppendNumber(char *Line_Ptr, uint8 Length, uint32 Value)
+{
+    char digits[10];
+    uint8 count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + (Value % 10u));
+        Value /= 10u;
+    } while (Value > 0);
+
+    while (count > 0 && Length < BOOTPROFILE_LINE_SIZE - 1)
+    {
+        Line_Ptr[Length++] = digits[--count];
+    }
+    return Length;
+}
+
+/* "name                 <cycles> cycles +<delta>" */
+static void BootProfile_WriteLine(const char *Name_Ptr, uint32 Cycles, uint32 Previous_Cycles)
+{
+    char line[BOOTPROFILE_LINE_SIZE];
+    uint8 length = 0;
+
+    length = BootProfile_AppendString(line, length, "boot: ", 0);
+    length = BootProfile_AppendString(line, length, Name_Ptr, BOOTPROFILE_NAME_WIDTH);
+    length = BootProfile_AppendNumber(line, length, Cycles);
+    length = BootProfile_AppendString(line, length, " cycles +", 0);
+    length = BootProfile_AppendNumber(line, length, Cycles - Previous_Cycles);
+    length = BootProfile_AppendString(line, length, "\r\n", 0);
+
+    (void)Rtt_Write(RTT_CHANNEL_TERMINAL, (const uint8 *)line, length);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: BootProfile_Start
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the DWT cycle counter from 0. It is called by
+  ResetISR() before the C initialization, so it must not use any variable.
+**********************************************************************/
+void BootProfile_Start(void)
+{
+    /* The cycle counter is not cleared by a system reset, restart it from here */
+    CORE_DEBUG_DEMCR_REG |= BOOTPROFILE_DEMCR_TRCENA_MASK;
+    DWT_CYCCNT_REG = 0;
+    DWT_CTRL_REG |= BOOTPROFILE_DWT_CTRL_CYCCNTENA_MASK;
+}
+
+/*********************************************************************
+* Service Name: BootProfile_Mark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Point - the boot point reached
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record the cycles since the reset at a boot point.
+  Only the first time counts, a later call for the same point is ignored.
+**********************************************************************/
+void BootProfile_Mark(BootProfile_PointType Point)
+{
+    uint32 cycles = DWT_CYCCNT_REG;
+
+    if (Point >= BOOTPROFILE_POINTS_NUM || g_BootProfile_Cycles[Point] != 0)
+    {
+        /*WRONG POINT OR ALREADY RECORDED DO NOTHING*/
+        return;
+    }
+    g_BootProfile_Cycles[Point] = cycles;
+}
+
+/*********************************************************************
+* Service Name: BootProfile_GetCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Point - boot point
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - cycles from the reset to the point, 0 if not reached
+* Description: Function to read one entry of the boot table.
+**********************************************************************/
+uint32 BootProfile_GetCycles(BootProfile_PointType Point)
+{
+    if (Point >= BOOTPROFILE_POINTS_NUM)
+    {
+        return 0;
+    }
+    return g_BootProfile_Cycles[Point];
+}
+
+/*********************************************************************
+* Service Name: BootProfile_Dump
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to print the startup phases and the boot points reached
+  so far on the RTT terminal channel, one line each with the cycles since the
+  reset and since the previous line.
+**********************************************************************/
+CODE_COLD void BootProfile_Dump(void)
+{
+    uint32 previous_cycles = 0;
+    uint32 cycles;
+    uint8 index;
+
+    /* Only the lean startup records its phases, they stay 0 after _c_int00 */
+    for (index = 0; index < STARTUP_PHASES_NUM; index++)
+    {
+        cycles = Startup_GetPhaseCycles((Startup_PhaseType)index);
+        if (cycles != 0)
+        {
+            BootProfile_WriteLine(g_BootProfile_StartupNames[index], cycles, previous_cycles);
+            previous_cycles = cycles;
+        }
+    }
+
+    for (index = 0; index < BOOTPROFILE_POINTS_NUM; index++)
+    {
+        cycles = g_BootProfile_Cycles[index];
+        if (cycles != 0)
+        {
+            BootProfile_WriteLine(g_BootProfile_Names[index], cycles, previous_cycles);
+            previous_cycles = cycles;
+        }
+    }
+}
@@ -0,0 +1,96 @@
+ /******************************************************************************
+ *
+ * Module: BootProfile
+ *
+ * File Name: BootProfile.h
+ *
+ * Description: Header file for the boot time profiler. The DWT cycle counter is
+ *              started in ResetISR(), every boot point records the counter once
+ *              and BootProfile_Dump() prints the table on the RTT terminal
+ *
+ *******************************************************************************/
+
+#ifndef BOOTPROFILE_H_
+#define BOOTPROFILE_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* Boot points in boot order, add new points before BOOTPROFILE_POINTS_NUM and
+ * give them a name in the names table in BootProfile.c */
+typedef enum
+{
+    BOOTPROFILE_POINT_MAIN_ENTRY,
+    BOOTPROFILE_POINT_DEBUG_READY,          /* stack monitor, profiler, trace and RTT */
+    BOOTPROFILE_POINT_RESET_CAUSE_CHECKED,  /* warm boot and fault record */
+    BOOTPROFILE_POINT_MPU_READY,
+    BOOTPROFILE_POINT_PORTF_READY,          /* clock, SW2, LEDs and the PORTF IRQ */
+    BOOTPROFILE_POINT_DELAY_READY,
+    BOOTPROFILE_POINT_SYSTICK_READY,
+    BOOTPROFILE_POINT_STEADY_STATE,         /* interrupts enabled, idle loop reached */
+    BOOTPROFILE_POINTS_NUM
+}BootProfile_PointType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: BootProfile_Start
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the DWT cycle counter from 0. It is called by
+  ResetISR() before the C initialization, so it must not use any variable.
+**********************************************************************/
+void BootProfile_Start(void);
+
+/*********************************************************************
+* Service Name: BootProfile_Mark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Point - the boot point reached
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record the cycles since the reset at a boot point.
+  Only the first time counts, a later call for the same point is ignored.
+**********************************************************************/
+void BootProfile_Mark(BootProfile_PointType Point);
+
+/*********************************************************************
+* Service Name: BootProfile_GetCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Point - boot point
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - cycles from the reset to the point, 0 if not reached
+* Description: Function to read one entry of the boot table.
+**********************************************************************/
+uint32 BootProfile_GetCycles(BootProfile_PointType Point);
+
+/*********************************************************************
+* Service Name: BootProfile_Dump
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to print the startup phases and the boot points reached
+  so far on the RTT terminal channel, one line each with the cycles since the
+  reset and since the previous line.
+**********************************************************************/
+void BootProfile_Dump(void);
+
+#endif /* BOOTPROFILE_H_ */
@@ -0,0 +1,41 @@
+ /******************************************************************************
+ *
+ * Module: CodeLayout
+ *
+ * File Name: CodeLayout.h
+ *
+ * Description: Header file for the code placement tags. CODE_HOT functions are
+ *              linked together at the start of .text, so the ISR paths share
+ *              flash lines and prefetch buffer hits, while CODE_COLD functions
+ *              (initialization and fault handling) are moved to the end of the
+ *              flash. See the .text specification in tm4c123gh6pm.cmd.
+ *              The linker can only order whole input sections: in a
+ *              LAYOUT_PROFILE build CODE_HOT is empty, so every hot function
+ *              keeps its own .text:<name> subsection for layout_profile.cmd
+ *
+ *******************************************************************************/
+
+#ifndef CODELAYOUT_H_
+#define CODELAYOUT_H_
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to TRUE to log the SysTick ISR path cycles after LAYOUT_BENCHMARK_TICKS
+ * SysTick periods, to compare the layouts. Build with RAMFUNC_ENABLE FALSE, the
+ * RAMFUNC ISRs do not run from the flash otherwise */
+#ifndef LAYOUT_BENCHMARK
+#define LAYOUT_BENCHMARK                     FALSE
+#endif
+#define LAYOUT_BENCHMARK_TICKS               16u
+
+/* Put before the return type of a function definition */
+#if defined(LAYOUT_PROFILE) && (LAYOUT_PROFILE == 1)
+#define CODE_HOT
+#else
+#define CODE_HOT                             __attribute__((section(".text:hot")))
+#endif
+#define CODE_COLD                            __attribute__((section(".text:cold")))
+
+#endif /* CODELAYOUT_H_ */
@@ -0,0 +1,52 @@
+ /******************************************************************************
+ *
+ * Module: Crc
+ *
+ * File Name: Crc.c
+ *
+ * Description: Source file for the CRC-16/CCITT calculation
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Crc.h"
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* CRC of every 4 bits value, 32 bytes instead of the 512 of a byte table */
+static const uint16 g_Crc16_NibbleTable[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Crc_Crc16
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Data_Ptr - data to check / Length - number of bytes / Crc - CRC16_INITIAL_VALUE or the result of the previous part
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - CRC of the data
+* Description: Function to calculate the CRC-16/CCITT of a block, a nibble at a
+  time with a 16 entries table. A block can be processed in several parts by
+  passing the result of a part as Crc of the next one.
+**********************************************************************/
+uint16 Crc_Crc16(const uint8 *Data_Ptr, uint32 Length, uint16 Crc)
+{
+    while (Length > 0)
+    {
+        Crc = (uint16)((Crc << 4) ^ g_Crc16_NibbleTable[(Crc >> 12) ^ (*Data_Ptr >> 4)]);
+        Crc = (uint16)((Crc << 4) ^ g_Crc16_NibbleTable[(Crc >> 12) ^ (*Data_Ptr & 0x0F)]);
+        Data_Ptr++;
+        Length--;
+    }
+    return Crc;
+}
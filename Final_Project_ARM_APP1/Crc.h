@@ -0,0 +1,46 @@
+ /******************************************************************************
+ *
+ * Module: Crc
+ *
+ * File Name: Crc.h
+ *
+ * Description: Header file for the CRC-16/CCITT calculation used to validate
+ *              data blocks kept in RAM or sent to the host
+ *
+ *******************************************************************************/
+
+#ifndef CRC_H_
+#define CRC_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* CRC-16/CCITT-FALSE: polynomial 0x1021, not reflected, no final XOR */
+#define CRC16_POLYNOMIAL                     0x1021u
+#define CRC16_INITIAL_VALUE                  0xFFFFu
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Crc_Crc16
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Data_Ptr - data to check / Length - number of bytes / Crc - CRC16_INITIAL_VALUE or the result of the previous part
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - CRC of the data
+* Description: Function to calculate the CRC-16/CCITT of a block, a nibble at a
+  time with a 16 entries table. A block can be processed in several parts by
+  passing the result of a part as Crc of the next one.
+**********************************************************************/
+uint16 Crc_Crc16(const uint8 *Data_Ptr, uint32 Length, uint16 Crc);
+
+#endif /* CRC_H_ */
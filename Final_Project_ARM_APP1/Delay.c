@@ -0,0 +1,185 @@
+ /******************************************************************************
+ *
+ * Module: Delay
+ *
+ * File Name: Delay.c
+ *
+ * Description: Source file for the self-calibrated busy-wait delay driver
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Delay.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define DELAY_SYSTICK_DISABLE                0x00
+#define DELAY_SYSTICK_ENABLE_WITH_PIOSC      0x01   /* ENABLE = 1, INTEN = 0, CLK_SRC = 0 (PIOSC/4) */
+#define DELAY_SYSTICK_MAX_RELOAD             0x00FFFFFF
+#define DELAY_US_PER_MS                      1000u
+
+/* Fallback used until Delay_Init() runs: 16 MHz system clock, 3 cycles per iteration */
+#define DELAY_DEFAULT_CALIBRATION            ((16u << DELAY_CALIBRATION_FRACTION_BITS) / 3u)
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Delay loop iterations per microsecond, with DELAY_CALIBRATION_FRACTION_BITS fraction bits */
+static uint32 g_IterationsPerUs = DELAY_DEFAULT_CALIBRATION;
+
+/* Delay loop iterations per millisecond, derived from g_IterationsPerUs */
+static uint32 g_IterationsPerMs = (DELAY_DEFAULT_CALIBRATION * DELAY_US_PER_MS) >> DELAY_CALIBRATION_FRACTION_BITS;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+
+/* Fixed-instruction delay loop (SUBS + BNE), written in assembly so that its
+ * length does not depend on the optimizer level. a_Iterations must not be 0. */
+void Delay_Loop(uint32 a_Iterations);
+
+__asm("    .sect \".text:Delay_Loop\"\n"
+      "    .clink\n"
+      "    .thumbfunc Delay_Loop\n"
+      "    .thumb\n"
+      "    .global Delay_Loop\n"
+      "Delay_Loop:\n"
+      "    subs    r0, #1\n"
+      "    bne.n   Delay_Loop\n"
+      "    bx      lr\n");
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Delay_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to calibrate the delay loop by timing a fixed number of
+  iterations against SysTick. It uses the SysTick timer, so it must be called
+  at startup before SysTick_Init(), and again after any clock change.
+**********************************************************************/
+CODE_COLD void Delay_Init(void)
+{
+    uint32 start_ticks;
+    uint32 end_ticks;
+    uint32 elapsed_ticks;
+
+    /* Run SysTick as a free running down counter from PIOSC/4 without interrupt */
+    SYSTICK_CTRL_REG = DELAY_SYSTICK_DISABLE;
+    SYSTICK_RELOAD_REG = DELAY_SYSTICK_MAX_RELOAD;
+    SYSTICK_CURRENT_REG = 0;
+    SYSTICK_CTRL_REG = DELAY_SYSTICK_ENABLE_WITH_PIOSC;
+
+    /* wait for the first reload so the start value is not the cleared zero */
+    while (SYSTICK_CURRENT_REG == 0);
+
+    start_ticks = SYSTICK_CURRENT_REG;
+    Delay_Loop(DELAY_CALIBRATION_ITERATIONS);
+    end_ticks = SYSTICK_CURRENT_REG;
+
+    /* Leave SysTick stopped and cleared for its own driver */
+    SYSTICK_CTRL_REG = DELAY_SYSTICK_DISABLE;
+    SYSTICK_CURRENT_REG = 0;
+
+    elapsed_ticks = (start_ticks - end_ticks) & DELAY_SYSTICK_MAX_RELOAD;
+    if (elapsed_ticks == 0)
+    {
+        /*CALIBRATION FAILED KEEP THE PREVIOUS VALUE*/
+        return;
+    }
+
+    g_IterationsPerUs = ((DELAY_CALIBRATION_ITERATIONS * DELAY_REFERENCE_TICKS_PER_US) << DELAY_CALIBRATION_FRACTION_BITS) / elapsed_ticks;
+    g_IterationsPerMs = (g_IterationsPerUs * DELAY_US_PER_MS) >> DELAY_CALIBRATION_FRACTION_BITS;
+}
+
+/*********************************************************************
+* Service Name: Delay_MS
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeInMilliSeconds - delay time in milliseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait for the specified time in milliseconds.
+**********************************************************************/
+void Delay_MS(uint32 a_TimeInMilliSeconds)
+{
+    while (a_TimeInMilliSeconds > 0)
+    {
+        Delay_Loop(g_IterationsPerMs);
+        a_TimeInMilliSeconds--;
+    }
+}
+
+/*********************************************************************
+* Service Name: Delay_US
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeInMicroSeconds - delay time in microseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait for the specified time in microseconds.
+**********************************************************************/
+void Delay_US(uint32 a_TimeInMicroSeconds)
+{
+    uint32 iterations;
+
+    /* Whole milliseconds first, so the iterations product below can not overflow */
+    Delay_MS(a_TimeInMicroSeconds / DELAY_US_PER_MS);
+
+    iterations = ((a_TimeInMicroSeconds % DELAY_US_PER_MS) * g_IterationsPerUs) >> DELAY_CALIBRATION_FRACTION_BITS;
+    if (iterations > 0)
+    {
+        Delay_Loop(iterations);
+    }
+}
+
+/*********************************************************************
+* Service Name: Delay_GetCalibration
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - delay loop iterations per microsecond (8 fraction bits)
+* Description: Function to read the result of the last calibration.
+**********************************************************************/
+uint32 Delay_GetCalibration(void)
+{
+    return g_IterationsPerUs;
+}
+
+/*********************************************************************
+* Service Name: Delay_SetCalibration
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): a_IterationsPerUs - delay loop iterations per microsecond (8 fraction bits)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to reuse a result of Delay_GetCalibration() instead of
+  calibrating again, e.g. after a warm reset with the same clock settings.
+**********************************************************************/
+void Delay_SetCalibration(uint32 a_IterationsPerUs)
+{
+    if (a_IterationsPerUs == 0)
+    {
+        /*WRONG CALIBRATION KEEP THE PREVIOUS VALUE*/
+        return;
+    }
+
+    g_IterationsPerUs = a_IterationsPerUs;
+    g_IterationsPerMs = (g_IterationsPerUs * DELAY_US_PER_MS) >> DELAY_CALIBRATION_FRACTION_BITS;
+}
@@ -0,0 +1,100 @@
+ /******************************************************************************
+ *
+ * Module: Delay
+ *
+ * File Name: Delay.h
+ *
+ * Description: Header file for the self-calibrated busy-wait delay driver
+ *
+ *******************************************************************************/
+
+#ifndef DELAY_H_
+#define DELAY_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Number of delay loop iterations timed during the calibration */
+#define DELAY_CALIBRATION_ITERATIONS         10000u
+
+/* The calibration reference is SysTick clocked from PIOSC/4, which runs at 4 MHz
+ * whatever the system clock configuration is */
+#define DELAY_REFERENCE_TICKS_PER_US         4u
+
+/* The calibration result is kept as a fixed point number with 8 fraction bits */
+#define DELAY_CALIBRATION_FRACTION_BITS      8u
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Delay_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to calibrate the delay loop by timing a fixed number of
+  iterations against SysTick. It uses the SysTick timer, so it must be called
+  at startup before SysTick_Init(), and again after any clock change.
+**********************************************************************/
+void Delay_Init(void);
+
+/*********************************************************************
+* Service Name: Delay_MS
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeInMilliSeconds - delay time in milliseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait for the specified time in milliseconds.
+**********************************************************************/
+void Delay_MS(uint32 a_TimeInMilliSeconds);
+
+/*********************************************************************
+* Service Name: Delay_US
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeInMicroSeconds - delay time in microseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to busy-wait for the specified time in microseconds.
+**********************************************************************/
+void Delay_US(uint32 a_TimeInMicroSeconds);
+
+/*********************************************************************
+* Service Name: Delay_GetCalibration
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - delay loop iterations per microsecond (8 fraction bits)
+* Description: Function to read the result of the last calibration.
+**********************************************************************/
+uint32 Delay_GetCalibration(void);
+
+/*********************************************************************
+* Service Name: Delay_SetCalibration
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): a_IterationsPerUs - delay loop iterations per microsecond (8 fraction bits)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to reuse a result of Delay_GetCalibration() instead of
+  calibrating again, e.g. after a warm reset with the same clock settings.
+**********************************************************************/
+void Delay_SetCalibration(uint32 a_IterationsPerUs);
+
+#endif /* DELAY_H_ */
@@ -0,0 +1,194 @@
+ /******************************************************************************
+ *
+ * Module: FPU
+ *
+ * File Name: FPU.c
+ *
+ * Description: Source file for the floating point unit management
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "FPU.h"
+#include "IrqLatency.h"
+#include "Log.h"
+#include "CodeLayout.h"
+
+#if (FPU_BENCHMARK == TRUE) && (IRQLATENCY_ENABLE != TRUE)
+#error "FPU_BENCHMARK needs IRQLATENCY_ENABLE"
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define FPU_FPCCR_STACKING_MASK              (FPU_FPCCR_ASPEN_MASK | FPU_FPCCR_LSPEN_MASK)
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Policy violations and the exception number of the last one */
+static volatile uint32 g_FPU_PolicyViolations = 0;
+static volatile uint32 g_FPU_LastViolation = 0;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Clear CONTROL.FPCA: the FPU registers of the caller are no longer live and the
+ * next exception entry stacks no FPU context */
+void FPU_DropContext(void);
+
+__asm("    .sect \".text:FPU_DropContext\"\n"
+      "    .clink\n"
+      "    .thumbfunc FPU_DropContext\n"
+      "    .thumb\n"
+      "    .global FPU_DropContext\n"
+      "FPU_DropContext:\n"
+      "    mrs     r0, CONTROL\n"
+      "    bic     r0, r0, #4\n"
+      "    msr     CONTROL, r0\n"
+      "    isb\n"
+      "    bx      lr\n");
+
+static void FPU_BenchmarkRun(IrqLatency_LoadType Load, FPU_LatencyType *Latency_Ptr)
+{
+    /* No SysTick samples are needed, the budgets are not checked */
+    const IrqLatency_ConfigType config =
+    {
+        Load, 0, FPU_BENCHMARK_SAMPLES, 0, 0xFFFFFFFF, 0xFFFFFFFF
+    };
+    IrqLatency_ReportType report;
+    const IrqLatency_StatsType *stats_ptr;
+
+    IrqLatency_Run(&config, &report);
+    stats_ptr = IrqLatency_GetStats(IRQLATENCY_PORTF);
+    Latency_Ptr->Min_Cycles = stats_ptr->Latency.Min_Cycles;
+    Latency_Ptr->Max_Cycles = stats_ptr->Latency.Max_Cycles;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: FPU_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the FPU with automatic and lazy state
+  preservation. It only writes core registers, so it can run before the C
+  run-time initialization.
+**********************************************************************/
+CODE_COLD void FPU_Init(void)
+{
+    FPU_CPACR_REG |= FPU_CPACR_FULL_ACCESS;
+    FPU_FPCC_REG |= FPU_FPCCR_STACKING_MASK;
+    __asm(" DSB");
+    __asm(" ISB");
+}
+
+/*********************************************************************
+* Service Name: FPU_SetStacking
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Stacking - FPU context preservation on exception entry
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to change the FPU context preservation, to be called
+  from thread mode.
+**********************************************************************/
+void FPU_SetStacking(FPU_StackingType Stacking)
+{
+    uint32 fpccr = FPU_FPCC_REG & ~FPU_FPCCR_STACKING_MASK;
+
+    switch (Stacking)
+    {
+    case FPU_STACKING_LAZY:
+        fpccr |= FPU_FPCCR_ASPEN_MASK | FPU_FPCCR_LSPEN_MASK;
+        break;
+    case FPU_STACKING_ALWAYS:
+        fpccr |= FPU_FPCCR_ASPEN_MASK;
+        break;
+    case FPU_STACKING_NONE:
+        break;
+    default:
+        /*WRONG STACKING MODE DO NOTHING*/
+        return;
+    }
+    FPU_FPCC_REG = fpccr;
+    __asm(" DSB");
+    __asm(" ISB");
+}
+
+/*********************************************************************
+* Service Name: FPU_PolicyViolation
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Exception - exception number of the handler
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to report a "no FPU" handler that used the FPU, called
+  by FPU_NOFPU_ISR_EXIT.
+**********************************************************************/
+void FPU_PolicyViolation(uint32 Exception)
+{
+    g_FPU_PolicyViolations++;
+    g_FPU_LastViolation = Exception;
+    LOG_1(LOG_LEVEL_WARNING, "FPU used by no-FPU handler of exception %u", Exception);
+}
+
+/*********************************************************************
+* Service Name: FPU_GetPolicyViolations
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Exception_Ptr - exception number of the last violation, may be NULL_PTR
+* Return value: uint32 - number of violations since reset
+* Description: Function to read the "no FPU" policy violations.
+**********************************************************************/
+uint32 FPU_GetPolicyViolations(uint32 *Exception_Ptr)
+{
+    if (Exception_Ptr != NULL_PTR)
+    {
+        *Exception_Ptr = g_FPU_LastViolation;
+    }
+    return g_FPU_PolicyViolations;
+}
+
+/*********************************************************************
+* Service Name: FPU_Benchmark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - entry latency per FPU context case
+* Return value: None
+* Description: Function to measure the GPIO PORTF IRQ entry latency without FPU
+  context and with FPU context stacked lazily and always, using IrqLatency_Run().
+  It has the same needs as IrqLatency_Run() and restores lazy stacking.
+**********************************************************************/
+CODE_COLD void FPU_Benchmark(FPU_BenchmarkReportType *Report_Ptr)
+{
+    if (Report_Ptr == NULL_PTR)
+    {
+        return;
+    }
+
+    FPU_SetStacking(FPU_STACKING_LAZY);
+    FPU_DropContext();
+    FPU_BenchmarkRun(IRQLATENCY_LOAD_NONE, &Report_Ptr->No_Context);
+    FPU_BenchmarkRun(IRQLATENCY_LOAD_FP_CONTEXT, &Report_Ptr->Lazy);
+
+    FPU_SetStacking(FPU_STACKING_ALWAYS);
+    FPU_BenchmarkRun(IRQLATENCY_LOAD_FP_CONTEXT, &Report_Ptr->Always);
+
+    FPU_SetStacking(FPU_STACKING_LAZY);
+}
@@ -0,0 +1,158 @@
+ /******************************************************************************
+ *
+ * Module: FPU
+ *
+ * File Name: FPU.h
+ *
+ * Description: Header file for the Cortex M4F floating point unit management.
+ *              The FPU context is preserved automatically and stacked lazily:
+ *              an interrupt reserves room for S0-S15 and FPSCR but the core
+ *              writes them only if the handler itself executes an FPU
+ *              instruction. Latency critical handlers can check that they
+ *              never do with the "no FPU" ISR policy
+ *
+ *******************************************************************************/
+
+#ifndef FPU_H_
+#define FPU_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* CP10 and CP11 full access */
+#define FPU_CPACR_FULL_ACCESS                0x00F00000u
+
+#define FPU_FPCCR_ASPEN_MASK                 0x80000000u   /* automatic state preservation, sets CONTROL.FPCA */
+#define FPU_FPCCR_LSPEN_MASK                 0x40000000u   /* lazy stacking of the S registers */
+#define FPU_FPCCR_LSPACT_MASK                0x00000001u   /* lazy state preservation pending */
+
+/* Set to FALSE to remove the "no FPU" ISR checks from the build */
+#ifndef FPU_NOFPU_CHECK
+#define FPU_NOFPU_CHECK                      TRUE
+#endif
+
+/* Set to TRUE to run FPU_Benchmark() from main() before the application starts */
+#ifndef FPU_BENCHMARK
+#define FPU_BENCHMARK                        FALSE
+#endif
+
+/* Software triggered PORTF IRQs per stacking mode in FPU_Benchmark() */
+#define FPU_BENCHMARK_SAMPLES                100u
+
+#if (FPU_NOFPU_CHECK == TRUE)
+/* "No FPU" policy of a handler: FPU_NOFPU_ISR_ENTER() must be the first statement
+ * after the IRQLATENCY/TRACE entry hooks and FPU_NOFPU_ISR_EXIT() must come before
+ * every return. If the handler interrupted live FPU registers, lazy stacking is
+ * pending on entry, and any FPU instruction of the handler forces the stacking
+ * and clears LSPACT. A handler preempting it that uses the FPU is blamed on it too. */
+#define FPU_NOFPU_ISR_ENTER()                uint32 fpu_lazy_pending = FPU_FPCC_REG & FPU_FPCCR_LSPACT_MASK
+#define FPU_NOFPU_ISR_EXIT(EXCEPTION)        do { if (fpu_lazy_pending && !(FPU_FPCC_REG & FPU_FPCCR_LSPACT_MASK)) \
+                                                  { FPU_PolicyViolation(EXCEPTION); } } while (0)
+#else
+#define FPU_NOFPU_ISR_ENTER()
+#define FPU_NOFPU_ISR_EXIT(EXCEPTION)
+#endif
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef enum
+{
+    FPU_STACKING_LAZY,      /* room is reserved on entry, S0-S15 are written only when the handler uses the FPU */
+    FPU_STACKING_ALWAYS,    /* S0-S15 and FPSCR are written on every entry from FPU code, 17 extra words */
+    FPU_STACKING_NONE       /* nothing is preserved, only safe if no handler uses the FPU */
+}FPU_StackingType;
+
+typedef struct
+{
+    uint32 Min_Cycles;
+    uint32 Max_Cycles;
+}FPU_LatencyType;
+
+/* PORTF IRQ entry latency, cycles from the software trigger to the handler */
+typedef struct
+{
+    FPU_LatencyType No_Context;    /* thread mode without live FPU registers */
+    FPU_LatencyType Lazy;          /* thread mode using the FPU, FPU_STACKING_LAZY */
+    FPU_LatencyType Always;        /* thread mode using the FPU, FPU_STACKING_ALWAYS */
+}FPU_BenchmarkReportType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: FPU_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the FPU with automatic and lazy state
+  preservation. It only writes core registers, so it can run before the C
+  run-time initialization.
+**********************************************************************/
+void FPU_Init(void);
+
+/*********************************************************************
+* Service Name: FPU_SetStacking
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Stacking - FPU context preservation on exception entry
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to change the FPU context preservation, to be called
+  from thread mode.
+**********************************************************************/
+void FPU_SetStacking(FPU_StackingType Stacking);
+
+/*********************************************************************
+* Service Name: FPU_PolicyViolation
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Exception - exception number of the handler
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to report a "no FPU" handler that used the FPU, called
+  by FPU_NOFPU_ISR_EXIT.
+**********************************************************************/
+void FPU_PolicyViolation(uint32 Exception);
+
+/*********************************************************************
+* Service Name: FPU_GetPolicyViolations
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Exception_Ptr - exception number of the last violation, may be NULL_PTR
+* Return value: uint32 - number of violations since reset
+* Description: Function to read the "no FPU" policy violations.
+**********************************************************************/
+uint32 FPU_GetPolicyViolations(uint32 *Exception_Ptr);
+
+/*********************************************************************
+* Service Name: FPU_Benchmark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - entry latency per FPU context case
+* Return value: None
+* Description: Function to measure the GPIO PORTF IRQ entry latency without FPU
+  context and with FPU context stacked lazily and always, using IrqLatency_Run().
+  It has the same needs as IrqLatency_Run() and restores lazy stacking.
+**********************************************************************/
+void FPU_Benchmark(FPU_BenchmarkReportType *Report_Ptr);
+
+#endif /* FPU_H_ */
@@ -0,0 +1,206 @@
+ /******************************************************************************
+ *
+ * Module: FaultCapture
+ *
+ * File Name: FaultCapture.c
+ *
+ * Description: Source file for the fault capture
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "FaultCapture.h"
+#include "MPU.h"
+#include "Log.h"
+#include "WarmBoot.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define FAULTCAPTURE_SRAM_START              0x20000000u
+#define FAULTCAPTURE_SRAM_END                0x20008000u
+
+/* Stacking and unstacking errors, the frame holds no valid data */
+#define FAULTCAPTURE_CFSR_STACKING_MASK      0x00001818u
+
+#define FAULTCAPTURE_DHCSR_C_DEBUGEN_MASK    0x00000001u
+#define FAULTCAPTURE_APINT_SYSRESREQ         0x05FA0004u
+
+/* Paste a number into the assembly source */
+#define FAULTCAPTURE_STRING(X)               #X
+#define FAULTCAPTURE_XSTRING(X)              FAULTCAPTURE_STRING(X)
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Kept over the system reset, C initialization does not touch it */
+#pragma NOINIT(g_FaultCapture_Record)
+static FaultCapture_RecordType g_FaultCapture_Record;
+
+static FaultCapture_RecordType g_FaultCapture_LastFault;
+static boolean g_FaultCapture_LastFaultValid = FALSE;
+
+/* Not static, the top of it is loaded by FaultCapture_Handler. 8 bytes aligned
+ * like any AAPCS stack, FaultCapture_Save() is plain C */
+#pragma DATA_ALIGN(g_FaultCapture_Stack, 8)
+uint32 g_FaultCapture_Stack[FAULTCAPTURE_HANDLER_STACK_BYTES / sizeof(uint32)];
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+void FaultCapture_Save(const uint32 *Frame_Ptr, uint32 Exc_Return, uint32 Ipsr);
+
+/* Find the exception frame like SysTick_Handler does, then move to the private
+ * stack before calling C: after an overflow the MSP points into the guard */
+__asm("    .sect \".text:FaultCapture_Handler\"\n"
+      "    .clink\n"
+      "    .thumbfunc FaultCapture_Handler\n"
+      "    .thumb\n"
+      "    .global FaultCapture_Handler\n"
+      "    .global FaultCapture_Save\n"
+      "    .global g_FaultCapture_Stack\n"
+      "FaultCapture_Handler:\n"
+      "    tst     lr, #4\n"
+      "    ite     eq\n"
+      "    mrseq   r0, msp\n"
+      "    mrsne   r0, psp\n"
+      "    mov     r1, lr\n"
+      "    mrs     r2, ipsr\n"
+      "    ldr     r3, FaultCapture_StackTop\n"
+      "    mov     sp, r3\n"
+      "    b.w     FaultCapture_Save\n"
+      "    .align  4\n"
+      "FaultCapture_StackTop:\n"
+      "    .word   g_FaultCapture_Stack + " FAULTCAPTURE_XSTRING(FAULTCAPTURE_HANDLER_STACK_BYTES) "\n");
+
+static boolean FaultCapture_IsReadable(const uint32 *Start_Ptr, uint32 Words_Num)
+{
+    uint32 start = (uint32)Start_Ptr;
+
+    return (boolean)((start >= FAULTCAPTURE_SRAM_START) && ((start & 3u) == 0u) &&
+                     (start + Words_Num * sizeof(uint32) <= FAULTCAPTURE_SRAM_END));
+}
+
+CODE_COLD void FaultCapture_Save(const uint32 *Frame_Ptr, uint32 Exc_Return, uint32 Ipsr)
+{
+    FaultCapture_RecordType *record_ptr = &g_FaultCapture_Record;
+    const uint32 *stack_ptr;
+    uint32 index;
+
+    /* The guard regions are plain SRAM, read them without faulting again */
+    MPU_Disable();
+
+    record_ptr->Exception = Ipsr & 0x1FFu;
+    record_ptr->Exc_Return = Exc_Return;
+    record_ptr->Stack_Pointer = (uint32)Frame_Ptr;
+    record_ptr->Cfsr = NVIC_SYSTEM->FAULTSTAT;
+    record_ptr->Hfsr = NVIC_SYSTEM->HFAULTSTAT;
+    record_ptr->Mmfar = NVIC_SYSTEM->MMADDR;
+    record_ptr->Bfar = NVIC_SYSTEM->FAULTADDR;
+
+    if (!(record_ptr->Cfsr & FAULTCAPTURE_CFSR_STACKING_MASK) &&
+        FaultCapture_IsReadable(Frame_Ptr, FAULTCAPTURE_FRAME_WORDS))
+    {
+        for (index = 0; index < FAULTCAPTURE_FRAME_WORDS; index++)
+        {
+            record_ptr->Frame[index] = Frame_Ptr[index];
+        }
+    }
+    else
+    {
+        for (index = 0; index < FAULTCAPTURE_FRAME_WORDS; index++)
+        {
+            record_ptr->Frame[index] = 0;
+        }
+    }
+
+    /*the caller's stack, as far as it is inside the SRAM*/
+    stack_ptr = Frame_Ptr + FAULTCAPTURE_FRAME_WORDS;
+    record_ptr->Stack_Words_Num = 0;
+    while (record_ptr->Stack_Words_Num < FAULTCAPTURE_STACK_WORDS && FaultCapture_IsReadable(stack_ptr, 1))
+    {
+        record_ptr->Stack[record_ptr->Stack_Words_Num++] = *stack_ptr++;
+    }
+    record_ptr->Magic = FAULTCAPTURE_MAGIC;
+
+    if (CORE_DEBUG_DHCSR_REG & FAULTCAPTURE_DHCSR_C_DEBUGEN_MASK)
+    {
+        /*stop here while a debugger is attached, resuming resets the system*/
+        __asm(" BKPT #0");
+    }
+
+    __asm(" DSB");
+    NVIC_SYSTEM->APINT = FAULTCAPTURE_APINT_SYSRESREQ;
+    __asm(" DSB");
+    while (1)
+    {
+        /*wait for the reset*/
+    }
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: FaultCapture_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to check whether the last reset was requested by
+  FaultCapture_Handler(). The record is logged, kept for
+  FaultCapture_GetLastFault() and invalidated in the no-init RAM. It should be
+  called after Rtt_Init() and WarmBoot_Init().
+**********************************************************************/
+CODE_COLD void FaultCapture_Init(void)
+{
+    const FaultCapture_RecordType *record_ptr = &g_FaultCapture_Record;
+
+    g_FaultCapture_LastFaultValid = FALSE;
+
+    /*a power-on leaves random data in the record, trust it only after a software reset*/
+    if ((WarmBoot_GetResetCause() & WARMBOOT_RESET_SOFTWARE) && record_ptr->Magic == FAULTCAPTURE_MAGIC)
+    {
+        g_FaultCapture_LastFault = *record_ptr;
+        g_FaultCapture_LastFaultValid = TRUE;
+
+        LOG_4(LOG_LEVEL_ERROR, "Reset after exception %u: PC 0x%08x LR 0x%08x xPSR 0x%08x",
+              record_ptr->Exception, record_ptr->Frame[FAULTCAPTURE_FRAME_PC_INDEX],
+              record_ptr->Frame[FAULTCAPTURE_FRAME_LR_INDEX], record_ptr->Frame[FAULTCAPTURE_FRAME_XPSR_INDEX]);
+        LOG_4(LOG_LEVEL_ERROR, "Fault status: CFSR 0x%08x HFSR 0x%08x MMFAR 0x%08x BFAR 0x%08x",
+              record_ptr->Cfsr, record_ptr->Hfsr, record_ptr->Mmfar, record_ptr->Bfar);
+        LOG_2(LOG_LEVEL_ERROR, "Fault frame at 0x%08x, EXC_RETURN 0x%08x",
+              record_ptr->Stack_Pointer, record_ptr->Exc_Return);
+    }
+
+    g_FaultCapture_Record.Magic = 0;
+}
+
+/*********************************************************************
+* Service Name: FaultCapture_GetLastFault
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Record_Ptr - the fault that caused the last reset
+* Return value: boolean - FALSE if the last reset was not caused by a fault
+* Description: Function to read the fault found by FaultCapture_Init().
+**********************************************************************/
+boolean FaultCapture_GetLastFault(FaultCapture_RecordType *Record_Ptr)
+{
+    if (!g_FaultCapture_LastFaultValid || Record_Ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    *Record_Ptr = g_FaultCapture_LastFault;
+    return TRUE;
+}
@@ -0,0 +1,107 @@
+ /******************************************************************************
+ *
+ * Module: FaultCapture
+ *
+ * File Name: FaultCapture.h
+ *
+ * Description: Header file for the fault capture. The fault and the unexpected
+ *              interrupt vectors save the exception frame, the fault status
+ *              registers and the top of the interrupted stack in no-init SRAM
+ *              and reset the system, the record is reported on the next boot
+ *
+ *******************************************************************************/
+
+#ifndef FAULTCAPTURE_H_
+#define FAULTCAPTURE_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Marks a record written by FaultCapture_Save(), "FALT" */
+#define FAULTCAPTURE_MAGIC                   0x544C4146u
+
+/* Words of the interrupted stack saved above the exception frame */
+#define FAULTCAPTURE_STACK_WORDS             16u
+
+/* Private stack of the handler, the faulting stack may be the one that overflowed.
+ * Plain number because it is also used in the assembly of FaultCapture.c */
+#define FAULTCAPTURE_HANDLER_STACK_BYTES     256
+
+/* Basic exception frame stacked by the core */
+#define FAULTCAPTURE_FRAME_WORDS             8u
+#define FAULTCAPTURE_FRAME_R0_INDEX          0u
+#define FAULTCAPTURE_FRAME_R12_INDEX         4u
+#define FAULTCAPTURE_FRAME_LR_INDEX          5u
+#define FAULTCAPTURE_FRAME_PC_INDEX          6u
+#define FAULTCAPTURE_FRAME_XPSR_INDEX        7u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 Magic;
+    uint32 Exception;                          /* IPSR, 3 for HardFault, 4 MemManage, 5 BusFault, 6 UsageFault */
+    uint32 Exc_Return;                         /* LR on exception entry */
+    uint32 Stack_Pointer;                      /* address of the exception frame */
+    uint32 Frame[FAULTCAPTURE_FRAME_WORDS];    /* R0-R3, R12, LR, PC, xPSR, zero if the frame was not readable */
+    uint32 Cfsr;                               /* configurable fault status (MemManage, BusFault and UsageFault) */
+    uint32 Hfsr;                               /* HardFault status */
+    uint32 Mmfar;                              /* MemManage fault address */
+    uint32 Bfar;                               /* BusFault address */
+    uint32 Stack_Words_Num;
+    uint32 Stack[FAULTCAPTURE_STACK_WORDS];    /* stack above the exception frame */
+}FaultCapture_RecordType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: FaultCapture_Handler
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler of the fault and unexpected interrupt vectors, it never
+  returns. With a debugger attached it stops at a breakpoint before the reset.
+**********************************************************************/
+void FaultCapture_Handler(void);
+
+/*********************************************************************
+* Service Name: FaultCapture_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to check whether the last reset was requested by
+  FaultCapture_Handler(). The record is logged, kept for
+  FaultCapture_GetLastFault() and invalidated in the no-init RAM. It should be
+  called after Rtt_Init() and WarmBoot_Init().
+**********************************************************************/
+void FaultCapture_Init(void);
+
+/*********************************************************************
+* Service Name: FaultCapture_GetLastFault
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Record_Ptr - the fault that caused the last reset
+* Return value: boolean - FALSE if the last reset was not caused by a fault
+* Description: Function to read the fault found by FaultCapture_Init().
+**********************************************************************/
+boolean FaultCapture_GetLastFault(FaultCapture_RecordType *Record_Ptr);
+
+#endif /* FAULTCAPTURE_H_ */
@@ -0,0 +1,259 @@
+ /******************************************************************************
+ *
+ * Module: IrqLatency
+ *
+ * File Name: IrqLatency.c
+ *
+ * Description: Source file for the interrupt latency and jitter benchmark
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "IrqLatency.h"
+#include "interruptsControl.h"
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Histograms of all IRQs */
+static IrqLatency_StatsType g_IrqLatency_Stats[IRQLATENCY_IRQS_NUM];
+
+/* Cycle counter at the last SysTick entry, used for the period jitter */
+static uint32 g_SysTick_LastStamp = 0;
+static volatile boolean g_SysTick_HasLastStamp = FALSE;
+
+/* Cycle counter when the benchmark pended the PORTF IRQ */
+static volatile uint32 g_PortF_TriggerStamp = 0;
+static volatile boolean g_PortF_TriggerPending = FALSE;
+
+/* Busy time of the PORTF ISR in the nested load mode */
+static volatile uint32 g_PortF_BusyCycles = 0;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+static void IrqLatency_HistogramReset(IrqLatency_HistogramType *Histogram_Ptr)
+{
+    uint8 bin;
+
+    Histogram_Ptr->Count = 0;
+    Histogram_Ptr->Min_Cycles = 0xFFFFFFFF;
+    Histogram_Ptr->Max_Cycles = 0;
+    for (bin = 0; bin < IRQLATENCY_HISTOGRAM_BINS; bin++)
+    {
+        Histogram_Ptr->Bins[bin] = 0;
+    }
+}
+
+static void IrqLatency_HistogramAdd(IrqLatency_HistogramType *Histogram_Ptr, uint32 Cycles)
+{
+    uint32 bin = Cycles / IRQLATENCY_BIN_WIDTH_CYCLES;
+
+    if (bin >= IRQLATENCY_HISTOGRAM_BINS)
+    {
+        bin = IRQLATENCY_HISTOGRAM_BINS - 1;
+    }
+    Histogram_Ptr->Bins[bin]++;
+    Histogram_Ptr->Count++;
+    if (Cycles < Histogram_Ptr->Min_Cycles)
+    {
+        Histogram_Ptr->Min_Cycles = Cycles;
+    }
+    if (Cycles > Histogram_Ptr->Max_Cycles)
+    {
+        Histogram_Ptr->Max_Cycles = Cycles;
+    }
+}
+
+/* Execute an FPU instruction and return CONTROL.FPCA (bit 2): set if the next
+ * exception entry has to preserve the FPU context. Written in assembly, the
+ * compiler could drop or move an FPU operation that does nothing */
+uint32 IrqLatency_UseFpu(void);
+
+__asm("    .sect \".text:IrqLatency_UseFpu\"\n"
+      "    .clink\n"
+      "    .thumbfunc IrqLatency_UseFpu\n"
+      "    .thumb\n"
+      "    .global IrqLatency_UseFpu\n"
+      "IrqLatency_UseFpu:\n"
+      "    vmov.f32 s0, s0\n"
+      "    mrs     r0, CONTROL\n"
+      "    and     r0, r0, #4\n"
+      "    bx      lr\n");
+
+static void IrqLatency_Busy(uint32 Cycles)
+{
+    uint32 start = DWT_CYCCNT_REG;
+
+    while ((DWT_CYCCNT_REG - start) < Cycles);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: IrqLatency_Reset
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the histograms of all IRQs.
+**********************************************************************/
+void IrqLatency_Reset(void)
+{
+    uint8 irq;
+
+    for (irq = 0; irq < IRQLATENCY_IRQS_NUM; irq++)
+    {
+        IrqLatency_HistogramReset(&g_IrqLatency_Stats[irq].Latency);
+        IrqLatency_HistogramReset(&g_IrqLatency_Stats[irq].Jitter);
+    }
+    g_SysTick_HasLastStamp = FALSE;
+}
+
+/*********************************************************************
+* Service Name: IrqLatency_SysTickEntry
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Latency_Cycles - cycles since the SysTick expiry / Entry_Stamp - cycle counter at entry
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record one SysTick entry, called by IRQLATENCY_SYSTICK_ENTRY.
+**********************************************************************/
+void IrqLatency_SysTickEntry(uint32 Latency_Cycles, uint32 Entry_Stamp)
+{
+    uint32 period;
+    uint32 expected_period;
+
+    IrqLatency_HistogramAdd(&g_IrqLatency_Stats[IRQLATENCY_SYSTICK].Latency, Latency_Cycles);
+
+    if (g_SysTick_HasLastStamp)
+    {
+        /*jitter is the distance between the measured and the programmed period*/
+        period = Entry_Stamp - g_SysTick_LastStamp;
+        expected_period = SYSTICK_RELOAD_REG + 1;
+        IrqLatency_HistogramAdd(&g_IrqLatency_Stats[IRQLATENCY_SYSTICK].Jitter,
+                                (period > expected_period) ? (period - expected_period) : (expected_period - period));
+    }
+    g_SysTick_LastStamp = Entry_Stamp;
+    g_SysTick_HasLastStamp = TRUE;
+}
+
+/*********************************************************************
+* Service Name: IrqLatency_PortFEntry
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Entry_Stamp - cycle counter at entry
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the IRQ was triggered by the benchmark
+* Description: Function to record one GPIO PORTF entry, called by IRQLATENCY_PORTF_ENTRY.
+  In the nested load mode it also keeps the ISR busy for the configured cycles.
+**********************************************************************/
+boolean IrqLatency_PortFEntry(uint32 Entry_Stamp)
+{
+    if (!g_PortF_TriggerPending)
+    {
+        /*real edge on the pin, nothing to measure*/
+        return FALSE;
+    }
+
+    IrqLatency_HistogramAdd(&g_IrqLatency_Stats[IRQLATENCY_PORTF].Latency, Entry_Stamp - g_PortF_TriggerStamp);
+    IrqLatency_Busy(g_PortF_BusyCycles);
+    g_PortF_TriggerPending = FALSE;
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: IrqLatency_Run
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Config_Ptr - load and number of samples of the run
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - worst case values of the run
+* Return value: None
+* Description: Function to run one benchmark from thread mode. It needs the
+  profiler cycle counter, the SysTick and the GPIO PORTF IRQ running and the
+  interrupts enabled. It returns once both IRQs have collected their samples,
+  so it takes SysTick_Samples SysTick periods at least.
+  In the FP context load mode the run stops and fails if the FPU instruction
+  did not set CONTROL.FPCA.
+**********************************************************************/
+void IrqLatency_Run(const IrqLatency_ConfigType *Config_Ptr, IrqLatency_ReportType *Report_Ptr)
+{
+    /* volatile view, the counts are updated by the ISRs while this function polls them */
+    const volatile IrqLatency_StatsType *systick_ptr = &g_IrqLatency_Stats[IRQLATENCY_SYSTICK];
+    const volatile IrqLatency_StatsType *portf_ptr = &g_IrqLatency_Stats[IRQLATENCY_PORTF];
+    boolean fp_context_lost = FALSE;
+
+    if (Config_Ptr == NULL_PTR || Report_Ptr == NULL_PTR)
+    {
+        return;
+    }
+
+    IrqLatency_Reset();
+    g_PortF_BusyCycles = (Config_Ptr->Load == IRQLATENCY_LOAD_NESTED) ? Config_Ptr->Load_Cycles : 0;
+
+    /* The jitter needs one extra SysTick entry to start from */
+    while (portf_ptr->Latency.Count < Config_Ptr->PortF_Samples ||
+           systick_ptr->Latency.Count <= Config_Ptr->SysTick_Samples)
+    {
+        if (!g_PortF_TriggerPending && portf_ptr->Latency.Count < Config_Ptr->PortF_Samples)
+        {
+            if (Config_Ptr->Load == IRQLATENCY_LOAD_FP_CONTEXT && !IrqLatency_UseFpu())
+            {
+                /*FPCA not set (no automatic state preservation): the run would measure no FPU context*/
+                fp_context_lost = TRUE;
+                break;
+            }
+
+            /*pend the PORTF IRQ by software, the ISR sees no PF0 edge flag*/
+            g_PortF_TriggerPending = TRUE;
+            g_PortF_TriggerStamp = DWT_CYCCNT_REG;
+            NVIC->SWTRIG = IRQLATENCY_PORTF_IRQ_NUM;
+        }
+
+        if (Config_Ptr->Load == IRQLATENCY_LOAD_MASKED)
+        {
+            Disable_Exceptions();
+            IrqLatency_Busy(Config_Ptr->Load_Cycles);
+            Enable_Exceptions();
+        }
+    }
+    g_PortF_BusyCycles = 0;
+
+    Report_Ptr->Load = Config_Ptr->Load;
+    Report_Ptr->SysTick_Worst_Latency = systick_ptr->Latency.Max_Cycles;
+    Report_Ptr->SysTick_Worst_Jitter = systick_ptr->Jitter.Max_Cycles;
+    Report_Ptr->PortF_Worst_Latency = portf_ptr->Latency.Max_Cycles;
+    Report_Ptr->Passed = (Report_Ptr->SysTick_Worst_Latency <= Config_Ptr->Latency_Budget_Cycles &&
+                          Report_Ptr->PortF_Worst_Latency <= Config_Ptr->Latency_Budget_Cycles &&
+                          Report_Ptr->SysTick_Worst_Jitter <= Config_Ptr->Jitter_Budget_Cycles &&
+                          !fp_context_lost) ? TRUE : FALSE;
+}
+
+/*********************************************************************
+* Service Name: IrqLatency_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Irq_Id - ID of the IRQ
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const IrqLatency_StatsType* - histograms or NULL_PTR for a wrong ID
+* Description: Function to access the histograms of the last run.
+**********************************************************************/
+const IrqLatency_StatsType* IrqLatency_GetStats(IrqLatency_IrqIdType Irq_Id)
+{
+    if (Irq_Id >= IRQLATENCY_IRQS_NUM)
+    {
+        return NULL_PTR;
+    }
+    return &g_IrqLatency_Stats[Irq_Id];
+}
@@ -0,0 +1,186 @@
+ /******************************************************************************
+ *
+ * Module: IrqLatency
+ *
+ * File Name: IrqLatency.h
+ *
+ * Description: Header file for the interrupt latency and jitter benchmark.
+ *              SysTick entry latency is read from the SysTick counter itself,
+ *              GPIO PORTF entry latency is measured on software triggered IRQs
+ *              and the SysTick period jitter is taken from the DWT cycle counter
+ *
+ *******************************************************************************/
+
+#ifndef IRQLATENCY_H_
+#define IRQLATENCY_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to TRUE to build the ISR entry hooks into SysTick_Handler and
+ * GPIOPortF_Handler, IrqLatency_Run() and the benchmarks built on it need them */
+#ifndef IRQLATENCY_ENABLE
+#define IRQLATENCY_ENABLE                    FALSE
+#endif
+
+/* Histograms are linear, every bin is IRQLATENCY_BIN_WIDTH_CYCLES wide and the
+ * last bin also counts everything longer */
+#define IRQLATENCY_HISTOGRAM_BINS            32u
+#define IRQLATENCY_BIN_WIDTH_CYCLES          4u
+
+/* Set to TRUE to run the benchmark table of main.c before the application starts */
+#ifndef IRQLATENCY_BENCHMARK
+#define IRQLATENCY_BENCHMARK                 FALSE
+#endif
+
+#if (IRQLATENCY_BENCHMARK == TRUE) && (IRQLATENCY_ENABLE != TRUE)
+#error "IRQLATENCY_BENCHMARK needs IRQLATENCY_ENABLE"
+#endif
+
+#define IRQLATENCY_PORTF_IRQ_NUM             30u
+
+#if (IRQLATENCY_ENABLE == TRUE)
+/* Must be the first statement of SysTick_Handler. The SysTick counts system clock
+ * cycles down from RELOAD, so RELOAD - CURRENT is the time since the expiry */
+#define IRQLATENCY_SYSTICK_ENTRY()           IrqLatency_SysTickEntry(SYSTICK_RELOAD_REG - SYSTICK_CURRENT_REG, DWT_CYCCNT_REG)
+
+/* Must be the first statement of GPIOPortF_Handler, TRUE if the IRQ was triggered
+ * by the benchmark */
+#define IRQLATENCY_PORTF_ENTRY()             IrqLatency_PortFEntry(DWT_CYCCNT_REG)
+#else
+#define IRQLATENCY_SYSTICK_ENTRY()
+#define IRQLATENCY_PORTF_ENTRY()             FALSE
+#endif
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef enum
+{
+    IRQLATENCY_SYSTICK,
+    IRQLATENCY_PORTF,
+    IRQLATENCY_IRQS_NUM
+}IrqLatency_IrqIdType;
+
+/* Background load applied by the thread mode while the benchmark runs */
+typedef enum
+{
+    IRQLATENCY_LOAD_NONE,
+    IRQLATENCY_LOAD_MASKED,   /* thread mode keeps interrupts masked (PRIMASK) for Load_Cycles at a time */
+    IRQLATENCY_LOAD_NESTED,   /* every PORTF IRQ stays busy for Load_Cycles, so SysTick has to preempt it */
+    IRQLATENCY_LOAD_FP_CONTEXT    /* thread mode uses the FPU right before every PORTF trigger, so the FPU context is live */
+}IrqLatency_LoadType;
+
+typedef struct
+{
+    uint32 Count;
+    uint32 Min_Cycles;
+    uint32 Max_Cycles;
+    uint32 Bins[IRQLATENCY_HISTOGRAM_BINS];
+}IrqLatency_HistogramType;
+
+typedef struct
+{
+    IrqLatency_HistogramType Latency;
+    IrqLatency_HistogramType Jitter;   /* absolute period error, only used for SysTick */
+}IrqLatency_StatsType;
+
+typedef struct
+{
+    IrqLatency_LoadType Load;
+    uint32 Load_Cycles;
+    uint16 PortF_Samples;
+    uint16 SysTick_Samples;
+    uint32 Latency_Budget_Cycles;
+    uint32 Jitter_Budget_Cycles;
+}IrqLatency_ConfigType;
+
+typedef struct
+{
+    IrqLatency_LoadType Load;
+    uint32 SysTick_Worst_Latency;
+    uint32 SysTick_Worst_Jitter;
+    uint32 PortF_Worst_Latency;
+    boolean Passed;
+}IrqLatency_ReportType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: IrqLatency_Reset
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the histograms of all IRQs.
+**********************************************************************/
+void IrqLatency_Reset(void);
+
+/*********************************************************************
+* Service Name: IrqLatency_SysTickEntry
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Latency_Cycles - cycles since the SysTick expiry / Entry_Stamp - cycle counter at entry
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to record one SysTick entry, called by IRQLATENCY_SYSTICK_ENTRY.
+**********************************************************************/
+void IrqLatency_SysTickEntry(uint32 Latency_Cycles, uint32 Entry_Stamp);
+
+/*********************************************************************
+* Service Name: IrqLatency_PortFEntry
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Entry_Stamp - cycle counter at entry
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the IRQ was triggered by the benchmark
+* Description: Function to record one GPIO PORTF entry, called by IRQLATENCY_PORTF_ENTRY.
+  In the nested load mode it also keeps the ISR busy for the configured cycles.
+**********************************************************************/
+boolean IrqLatency_PortFEntry(uint32 Entry_Stamp);
+
+/*********************************************************************
+* Service Name: IrqLatency_Run
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Config_Ptr - load and number of samples of the run
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - worst case values of the run
+* Return value: None
+* Description: Function to run one benchmark from thread mode. It needs the
+  profiler cycle counter, the SysTick and the GPIO PORTF IRQ running and the
+  interrupts enabled. It returns once both IRQs have collected their samples,
+  so it takes SysTick_Samples SysTick periods at least. Without
+  IRQLATENCY_ENABLE no sample is collected and it never returns.
+  In the FP context load mode the run stops and fails if the FPU instruction
+  did not set CONTROL.FPCA.
+**********************************************************************/
+void IrqLatency_Run(const IrqLatency_ConfigType *Config_Ptr, IrqLatency_ReportType *Report_Ptr);
+
+/*********************************************************************
+* Service Name: IrqLatency_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Irq_Id - ID of the IRQ
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const IrqLatency_StatsType* - histograms or NULL_PTR for a wrong ID
+* Description: Function to access the histograms of the last run.
+**********************************************************************/
+const IrqLatency_StatsType* IrqLatency_GetStats(IrqLatency_IrqIdType Irq_Id);
+
+#endif /* IRQLATENCY_H_ */
@@ -0,0 +1,63 @@
+ /******************************************************************************
+ *
+ * Module: Log
+ *
+ * File Name: Log.c
+ *
+ * Description: Source file for the deferred binary logger
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Log.h"
+#include "Rtt.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+static volatile uint32 g_Log_Dropped = 0;
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Log_Write
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Words_Ptr - header word and argument words / Words_Num - number of words
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to send one encoded log statement to the binary RTT up
+  channel, called by the LOG_x macros. A statement that does not fit is dropped
+  whole, so the stream never loses its framing.
+**********************************************************************/
+CODE_HOT void Log_Write(const uint32 *Words_Ptr, uint8 Words_Num)
+{
+    uint32 size = (uint32)Words_Num * sizeof(uint32);
+
+    /* The binary channel is left in the skip mode, a write is all or nothing */
+    if (Rtt_Write(RTT_CHANNEL_BINARY, (const uint8 *)Words_Ptr, size) != size)
+    {
+        g_Log_Dropped++;
+    }
+}
+
+/*********************************************************************
+* Service Name: Log_GetDropped
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of statements dropped because the channel was full
+* Description: Function to read the dropped statements counter.
+**********************************************************************/
+uint32 Log_GetDropped(void)
+{
+    return g_Log_Dropped;
+}
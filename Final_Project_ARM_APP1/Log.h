@@ -0,0 +1,109 @@
+ /******************************************************************************
+ *
+ * Module: Log
+ *
+ * File Name: Log.h
+ *
+ * Description: Header file for the deferred binary logger. The format strings
+ *              are placed in the .logstr section, which is linked but never
+ *              loaded to the target, and a log statement only sends a header
+ *              word with the string ID followed by the raw argument words.
+ *              tools/log_decode.py rebuilds the messages from the ELF file
+ *
+ *******************************************************************************/
+
+#ifndef LOG_H_
+#define LOG_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Levels, lower is more severe */
+#define LOG_LEVEL_ERROR                      1u
+#define LOG_LEVEL_WARNING                    2u
+#define LOG_LEVEL_INFO                       3u
+#define LOG_LEVEL_DEBUG                      4u
+
+/* Statements above this level are compiled out */
+#ifndef LOG_LEVEL
+#define LOG_LEVEL                            LOG_LEVEL_INFO
+#endif
+
+/* Header word: level (31:29), number of arguments (28:26) and string ID (23:0).
+ * The ID is the offset of the format string in the .logstr section */
+#define LOG_LEVEL_SHIFT                      29u
+#define LOG_ARGS_NUM_SHIFT                   26u
+#define LOG_ID_MASK                          0x00FFFFFFu
+#define LOG_ARGS_MAX_NUM                     4u
+
+#define LOG_HEADER(LEVEL, FORMAT_PTR, ARGS_NUM) \
+    (((uint32)(LEVEL) << LOG_LEVEL_SHIFT) | ((uint32)(ARGS_NUM) << LOG_ARGS_NUM_SHIFT) | ((uint32)(FORMAT_PTR) & LOG_ID_MASK))
+
+/* Define the format string of one statement in the .logstr section */
+#define LOG_FORMAT(FORMAT) \
+    static const char Log_Format[] __attribute__((section(".logstr"))) = FORMAT
+
+/* Log statements with 0 to 4 integer arguments, the format string takes the
+ * printf conversions %d, %u, %x and %c only */
+#define LOG_0(LEVEL, FORMAT) \
+    do { if ((LEVEL) <= LOG_LEVEL) { LOG_FORMAT(FORMAT); \
+        uint32 log_words[1] = {LOG_HEADER(LEVEL, Log_Format, 0)}; \
+        Log_Write(log_words, 1); } } while (0)
+
+#define LOG_1(LEVEL, FORMAT, ARG1) \
+    do { if ((LEVEL) <= LOG_LEVEL) { LOG_FORMAT(FORMAT); \
+        uint32 log_words[2] = {LOG_HEADER(LEVEL, Log_Format, 1), (uint32)(ARG1)}; \
+        Log_Write(log_words, 2); } } while (0)
+
+#define LOG_2(LEVEL, FORMAT, ARG1, ARG2) \
+    do { if ((LEVEL) <= LOG_LEVEL) { LOG_FORMAT(FORMAT); \
+        uint32 log_words[3] = {LOG_HEADER(LEVEL, Log_Format, 2), (uint32)(ARG1), (uint32)(ARG2)}; \
+        Log_Write(log_words, 3); } } while (0)
+
+#define LOG_3(LEVEL, FORMAT, ARG1, ARG2, ARG3) \
+    do { if ((LEVEL) <= LOG_LEVEL) { LOG_FORMAT(FORMAT); \
+        uint32 log_words[4] = {LOG_HEADER(LEVEL, Log_Format, 3), (uint32)(ARG1), (uint32)(ARG2), (uint32)(ARG3)}; \
+        Log_Write(log_words, 4); } } while (0)
+
+#define LOG_4(LEVEL, FORMAT, ARG1, ARG2, ARG3, ARG4) \
+    do { if ((LEVEL) <= LOG_LEVEL) { LOG_FORMAT(FORMAT); \
+        uint32 log_words[5] = {LOG_HEADER(LEVEL, Log_Format, 4), (uint32)(ARG1), (uint32)(ARG2), (uint32)(ARG3), (uint32)(ARG4)}; \
+        Log_Write(log_words, 5); } } while (0)
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Log_Write
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Words_Ptr - header word and argument words / Words_Num - number of words
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to send one encoded log statement to the binary RTT up
+  channel, called by the LOG_x macros. A statement that does not fit is dropped
+  whole, so the stream never loses its framing.
+**********************************************************************/
+void Log_Write(const uint32 *Words_Ptr, uint8 Words_Num);
+
+/*********************************************************************
+* Service Name: Log_GetDropped
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of statements dropped because the channel was full
+* Description: Function to read the dropped statements counter.
+**********************************************************************/
+uint32 Log_GetDropped(void);
+
+#endif /* LOG_H_ */
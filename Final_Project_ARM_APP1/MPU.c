@@ -0,0 +1,266 @@
+ /******************************************************************************
+ *
+ * Module: MPU
+ *
+ * File Name: MPU.c
+ *
+ * Description: Source file for the ARM Cortex M4 MPU driver
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "MPU.h"
+#include "NVIC.h"
+#include "Log.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define MPU_CTRL_ENABLE_MASK                 0x00000001
+#define MPU_CTRL_PRIVDEFENA_MASK             0x00000004
+
+#define MPU_ATTR_ENABLE_MASK                 0x00000001
+#define MPU_ATTR_SIZE_BITS_POS               1
+#define MPU_ATTR_SRD_BITS_POS                8
+#define MPU_ATTR_MEMORY_BITS_POS             16
+#define MPU_ATTR_AP_BITS_POS                 24
+#define MPU_ATTR_XN_BIT_POS                  28
+
+#define MPU_BASE_ADDRESS_MASK                0xFFFFFFE0
+#define MPU_MAX_SIZE_LOG2                    32u
+
+/* Make the new region settings visible to the next instruction fetch and data access */
+#define MPU_Barrier()                        do { __asm(" DSB"); __asm(" ISB"); } while (0)
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Next region for a stack guard, guards are allocated from the top region down */
+static MPU_RegionType g_NextGuardRegion = MPU_REGIONS_NUM - 1;
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: MPU_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set up the default layout: flash read-only and
+  executable, SRAM read-write and never executable, everything else on the
+  privileged default memory map. It enables the MemManage fault and the MPU.
+**********************************************************************/
+CODE_COLD void MPU_Init(void)
+{
+    const MPU_RegionConfigType flash_region =
+    {
+        MPU_FLASH_BASE_ADDRESS, MPU_FLASH_SIZE_LOG2, MPU_AP_READ_ONLY, MPU_ATTR_FLASH, FALSE, 0
+    };
+    const MPU_RegionConfigType sram_region =
+    {
+        MPU_SRAM_BASE_ADDRESS, MPU_SRAM_SIZE_LOG2, MPU_AP_FULL_ACCESS, MPU_ATTR_INTERNAL_SRAM, TRUE, 0
+    };
+    MPU_RegionType region;
+
+    MPU_Disable();
+    for (region = 0; region < MPU_REGIONS_NUM; region++)
+    {
+        MPU_DisableRegion(region);
+    }
+    g_NextGuardRegion = MPU_REGIONS_NUM - 1;
+
+    (void)MPU_ConfigureRegion(MPU_REGION_FLASH, &flash_region);
+    (void)MPU_ConfigureRegion(MPU_REGION_SRAM, &sram_region);
+
+    /* Report violations as MemManage faults instead of escalating to HardFault */
+    NVIC_EnableException(EXCEPTION_MEM_FAULT_TYPE);
+    MPU_Enable();
+}
+
+/*********************************************************************
+* Service Name: MPU_ConfigureRegion
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Region - region number / Config_Ptr - region settings
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the region number or the settings are wrong
+* Description: Function to program and enable one MPU region.
+**********************************************************************/
+boolean MPU_ConfigureRegion(MPU_RegionType Region, const MPU_RegionConfigType *Config_Ptr)
+{
+    uint32 size_mask;
+
+    if (Region >= MPU_REGIONS_NUM || Config_Ptr == NULL_PTR ||
+        Config_Ptr->Size_Log2 < MPU_MIN_SIZE_LOG2 || Config_Ptr->Size_Log2 > MPU_MAX_SIZE_LOG2)
+    {
+        LOG_1(LOG_LEVEL_ERROR, "MPU_ConfigureRegion: invalid region %u or size", Region);
+        return FALSE;
+    }
+
+    /*the base must be aligned to the region size*/
+    size_mask = (Config_Ptr->Size_Log2 == MPU_MAX_SIZE_LOG2) ? 0xFFFFFFFF : ((1uL << Config_Ptr->Size_Log2) - 1);
+    if (Config_Ptr->Base_Address & size_mask)
+    {
+        LOG_2(LOG_LEVEL_ERROR, "MPU_ConfigureRegion: base 0x%08x not aligned for region %u", Config_Ptr->Base_Address, Region);
+        return FALSE;
+    }
+
+    MPU_NUMBER_REG = Region;
+    MPU_ATTR_REG = 0;
+    MPU_BASE_REG = Config_Ptr->Base_Address & MPU_BASE_ADDRESS_MASK;
+    MPU_ATTR_REG = ((uint32)(Config_Ptr->Execute_Never ? 1 : 0) << MPU_ATTR_XN_BIT_POS) |
+                   ((uint32)Config_Ptr->Access << MPU_ATTR_AP_BITS_POS) |
+                   ((uint32)Config_Ptr->Attributes << MPU_ATTR_MEMORY_BITS_POS) |
+                   ((uint32)Config_Ptr->SubRegion_Disable << MPU_ATTR_SRD_BITS_POS) |
+                   ((uint32)(Config_Ptr->Size_Log2 - 1) << MPU_ATTR_SIZE_BITS_POS) |
+                   MPU_ATTR_ENABLE_MASK;
+    MPU_Barrier();
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: MPU_DisableRegion
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Region - region number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable one MPU region.
+**********************************************************************/
+void MPU_DisableRegion(MPU_RegionType Region)
+{
+    if (Region >= MPU_REGIONS_NUM)
+    {
+        /*WRONG REGION NUM DO NOTHING*/
+        return;
+    }
+    MPU_NUMBER_REG = Region;
+    MPU_ATTR_REG = 0;
+    MPU_Barrier();
+}
+
+/*********************************************************************
+* Service Name: MPU_AddStackGuard
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Stack_Bottom_Ptr - lowest address of the stack
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32* - first address above the guard or NULL_PTR if no region is left
+* Description: Function to place a 32 bytes no-access region at the bottom of a
+  stack. The guard starts at the bottom rounded up to 32 bytes, so the stack
+  loses up to 63 bytes, and the memory below the returned address must not be
+  touched any more (e.g. by the stack monitor).
+**********************************************************************/
+uint32* MPU_AddStackGuard(uint32 *Stack_Bottom_Ptr)
+{
+    MPU_RegionConfigType guard_region =
+    {
+        0, MPU_MIN_SIZE_LOG2, MPU_AP_NO_ACCESS, MPU_ATTR_INTERNAL_SRAM, TRUE, 0
+    };
+
+    if (g_NextGuardRegion < MPU_FIRST_FREE_REGION || Stack_Bottom_Ptr == NULL_PTR)
+    {
+        LOG_0(LOG_LEVEL_ERROR, "MPU_AddStackGuard: no free region");
+        return NULL_PTR;
+    }
+
+    guard_region.Base_Address = ((uint32)Stack_Bottom_Ptr + MPU_STACK_GUARD_SIZE - 1) & ~(MPU_STACK_GUARD_SIZE - 1);
+    if (!MPU_ConfigureRegion(g_NextGuardRegion, &guard_region))
+    {
+        return NULL_PTR;
+    }
+    g_NextGuardRegion--;
+
+    return (uint32 *)(guard_region.Base_Address + MPU_STACK_GUARD_SIZE);
+}
+
+/*********************************************************************
+* Service Name: MPU_AddSramCodeRegion
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Base_Address - start of the code / Size - code size in bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the code is not aligned to its region size
+* Description: Function to make code copied to SRAM executable and read-only.
+  The region is the size rounded up to a power of two, so the base must be
+  aligned to it. From 256 bytes on only the eighths of the region that hold
+  code are enabled, the others keep the SRAM settings, so the code must be
+  padded to an eighth of the region (the .ramfunc section of the linker
+  command file is).
+**********************************************************************/
+boolean MPU_AddSramCodeRegion(uint32 Base_Address, uint32 Size)
+{
+    MPU_RegionConfigType code_region =
+    {
+        0, MPU_MIN_SIZE_LOG2, MPU_AP_READ_ONLY, MPU_ATTR_INTERNAL_SRAM, FALSE, 0
+    };
+    uint32 subregion_size;
+    uint32 subregions_used;
+
+    if (Size == 0)
+    {
+        /*NO SRAM CODE DO NOTHING*/
+        return TRUE;
+    }
+
+    while (code_region.Size_Log2 < MPU_MAX_SIZE_LOG2 && (1uL << code_region.Size_Log2) < Size)
+    {
+        code_region.Size_Log2++;
+    }
+    code_region.Base_Address = Base_Address;
+
+    /* Disable the eighths past the code, the data behind it stays writable */
+    if (code_region.Size_Log2 >= MPU_SUBREGION_MIN_SIZE_LOG2)
+    {
+        subregion_size = (1uL << code_region.Size_Log2) / MPU_SUBREGIONS_NUM;
+        subregions_used = (Size + subregion_size - 1) / subregion_size;
+        code_region.SubRegion_Disable = (uint8)(0xFFu << subregions_used);
+    }
+    return MPU_ConfigureRegion(MPU_REGION_SRAM_CODE, &code_region);
+}
+
+/*********************************************************************
+* Service Name: MPU_Enable
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the MPU with the default memory map as
+  background region for privileged accesses.
+**********************************************************************/
+void MPU_Enable(void)
+{
+    MPU_CTRL_REG = MPU_CTRL_PRIVDEFENA_MASK | MPU_CTRL_ENABLE_MASK;
+    MPU_Barrier();
+}
+
+/*********************************************************************
+* Service Name: MPU_Disable
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the MPU, the region settings are kept.
+**********************************************************************/
+void MPU_Disable(void)
+{
+    MPU_Barrier();
+    MPU_CTRL_REG = 0;
+    MPU_Barrier();
+}
@@ -0,0 +1,178 @@
+ /******************************************************************************
+ *
+ * Module: MPU
+ *
+ * File Name: MPU.h
+ *
+ * Description: Header file for the ARM Cortex M4 MPU driver. It sets the memory
+ *              attributes of the flash and the SRAM and places no-access guard
+ *              regions below the stacks, so a stack overflow faults on the
+ *              first access to the guard
+ *
+ *******************************************************************************/
+
+#ifndef MPU_H_
+#define MPU_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+#define MPU_REGIONS_NUM                      8u
+
+/* Fixed regions of MPU_Init(), the stack guards take the regions from the top
+ * down because a higher region number wins where regions overlap */
+#define MPU_REGION_FLASH                     0u
+#define MPU_REGION_SRAM                      1u
+#define MPU_REGION_SRAM_CODE                 2u
+#define MPU_FIRST_FREE_REGION                3u
+
+#define MPU_FLASH_BASE_ADDRESS               0x00000000u
+#define MPU_FLASH_SIZE_LOG2                  18u    /* 256 KB */
+#define MPU_SRAM_BASE_ADDRESS                0x20000000u
+#define MPU_SRAM_SIZE_LOG2                   15u    /* 32 KB */
+
+/* Smallest region, also the size of a stack guard */
+#define MPU_MIN_SIZE_LOG2                    5u
+#define MPU_STACK_GUARD_SIZE                 (1u << MPU_MIN_SIZE_LOG2)
+
+/* A region is split in 8 subregions, from 256 bytes regions on */
+#define MPU_SUBREGIONS_NUM                   8u
+#define MPU_SUBREGION_MIN_SIZE_LOG2          8u
+
+/* Access permissions (AP field) as privileged / unprivileged */
+#define MPU_AP_NO_ACCESS                     0u
+#define MPU_AP_PRIV_RW                       1u
+#define MPU_AP_PRIV_RW_USER_RO               2u
+#define MPU_AP_FULL_ACCESS                   3u
+#define MPU_AP_PRIV_RO                       5u
+#define MPU_AP_READ_ONLY                     6u
+
+/* Memory attributes TEX(5:3) S(2) C(1) B(0) as recommended by the TM4C123GH6PM
+ * data sheet for each memory type */
+#define MPU_ATTR_FLASH                       0x02u   /* normal, not shareable, write-through */
+#define MPU_ATTR_INTERNAL_SRAM               0x06u   /* normal, shareable, write-through */
+#define MPU_ATTR_PERIPHERAL                  0x05u   /* device, shareable */
+#define MPU_ATTR_STRONGLY_ORDERED            0x00u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef uint8 MPU_RegionType;
+
+typedef struct
+{
+    uint32 Base_Address;          /* aligned to the region size */
+    uint8 Size_Log2;              /* 5 (32 bytes) to 32 (4 GB) */
+    uint8 Access;                 /* MPU_AP_xxx */
+    uint8 Attributes;             /* MPU_ATTR_xxx */
+    boolean Execute_Never;
+    uint8 SubRegion_Disable;      /* one bit per 1/8 of the region, 0 to use all of it */
+}MPU_RegionConfigType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: MPU_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set up the default layout: flash read-only and
+  executable, SRAM read-write and never executable, everything else on the
+  privileged default memory map. It enables the MemManage fault and the MPU.
+**********************************************************************/
+void MPU_Init(void);
+
+/*********************************************************************
+* Service Name: MPU_ConfigureRegion
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Region - region number / Config_Ptr - region settings
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the region number or the settings are wrong
+* Description: Function to program and enable one MPU region.
+**********************************************************************/
+boolean MPU_ConfigureRegion(MPU_RegionType Region, const MPU_RegionConfigType *Config_Ptr);
+
+/*********************************************************************
+* Service Name: MPU_DisableRegion
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Region - region number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable one MPU region.
+**********************************************************************/
+void MPU_DisableRegion(MPU_RegionType Region);
+
+/*********************************************************************
+* Service Name: MPU_AddStackGuard
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Stack_Bottom_Ptr - lowest address of the stack
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32* - first address above the guard or NULL_PTR if no region is left
+* Description: Function to place a 32 bytes no-access region at the bottom of a
+  stack. The guard starts at the bottom rounded up to 32 bytes, so the stack
+  loses up to 63 bytes, and the memory below the returned address must not be
+  touched any more (e.g. by the stack monitor).
+**********************************************************************/
+uint32* MPU_AddStackGuard(uint32 *Stack_Bottom_Ptr);
+
+/*********************************************************************
+* Service Name: MPU_AddSramCodeRegion
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Base_Address - start of the code / Size - code size in bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the code is not aligned to its region size
+* Description: Function to make code copied to SRAM executable and read-only.
+  The region is the size rounded up to a power of two, so the base must be
+  aligned to it. From 256 bytes on only the eighths of the region that hold
+  code are enabled, the others keep the SRAM settings, so the code must be
+  padded to an eighth of the region (the .ramfunc section of the linker
+  command file is).
+**********************************************************************/
+boolean MPU_AddSramCodeRegion(uint32 Base_Address, uint32 Size);
+
+/*********************************************************************
+* Service Name: MPU_Enable
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the MPU with the default memory map as
+  background region for privileged accesses.
+**********************************************************************/
+void MPU_Enable(void);
+
+/*********************************************************************
+* Service Name: MPU_Disable
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the MPU, the region settings are kept.
+**********************************************************************/
+void MPU_Disable(void);
+
+#endif /* MPU_H_ */
@@ -6,7 +6,12 @@
  */
 
 #include "NVIC.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include "Log.h"
+#include "RamFunc.h"
 #include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
 
 #define NVIC_PRI0_REG_ADD                (uint32*)0xE000E400
 #define NVIC_MICRO_TOTAL_INT_NUM                138
@@ -16,6 +21,32 @@
 #define NUM_OF_BITS_BETWEEN_TWO_PRI_POS         8
 #define MASK_3_BITS                             0x00000007
 
+/*******************************************************************************
+ *                           Private Data Types                                *
+ *******************************************************************************/
+
+/* Run-time state of a rate limiter channel. Every counter has a single writer:
+ * the guarded ISR owns Event_Count, Dropped_Count and Trip_Count, while
+ * NVIC_RateLimitTick() owns the window and re-arm fields. So no critical
+ * section is needed between the two contexts. The channel is tripped (masked)
+ * as long as Trip_Count != Rearm_Count. */
+typedef struct
+{
+    const NVIC_RateLimitConfigType *Config_Ptr;
+    volatile uint32 Event_Count;
+    volatile uint32 Dropped_Count;
+    volatile uint32 Trip_Count;
+    volatile uint32 Window_Start_Count;
+    volatile uint32 Rearm_Count;
+    uint8 Window_Elapsed;
+    uint8 HoldOff_Elapsed;
+}NVIC_RateLimitStateType;
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+static NVIC_RateLimitStateType g_RateLimitState[NVIC_RATE_LIMIT_MAX_CHANNELS];
+
 /*******************************************************************************
  *                         Public Functions Definitions                        *
  *******************************************************************************/
@@ -38,6 +69,7 @@
 **********************************************************************/
 void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num)
 {
+    TRACE_IRQ_ENABLE(IRQ_Num);
 
    /*Each register can control 32 interrupt/ so we can use this switch case
     * to find the right register to change and then set the corresponding bit */
@@ -65,6 +97,7 @@ void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num)
     else
     {
         /*WRONG IRQ_NUM DO NOTHING*/
+        LOG_1(LOG_LEVEL_ERROR, "NVIC_EnableIRQ: invalid IRQ %u", IRQ_Num);
     }
 }
 
@@ -80,6 +113,7 @@ void NVIC_EnableIRQ(NVIC_IRQType IRQ_Num)
 **********************************************************************/
 void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num)
 {
+    TRACE_IRQ_DISABLE(IRQ_Num);
 
     /*Each register can control 32 interrupt/ so we can use this switch case
      * to find the right register to change and then set the corresponding bit */
@@ -106,6 +140,7 @@ void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num)
     else
     {
         /*WRONG IRQ_NUM DO NOTHING*/
+        LOG_1(LOG_LEVEL_ERROR, "NVIC_DisableIRQ: invalid IRQ %u", IRQ_Num);
     }
 }
 
@@ -121,9 +156,11 @@ void NVIC_DisableIRQ(NVIC_IRQType IRQ_Num)
 **********************************************************************/
 void NVIC_SetPriorityIRQ(NVIC_IRQType IRQ_Num, NVIC_IRQPriorityType IRQ_Priority)
 {
+    PROFILER_BEGIN(PROFILER_PROBE_NVIC_SET_PRIORITY_IRQ);
     if (IRQ_Num > NVIC_MICRO_TOTAL_INT_NUM || IRQ_Priority > 7)
     {
         /*WRONG IRQ_NUM DO NOTHING*/ /*or wrong priority num*/
+        LOG_2(LOG_LEVEL_ERROR, "NVIC_SetPriorityIRQ: invalid IRQ %u or priority %u", IRQ_Num, IRQ_Priority);
     }
     else
     {
@@ -140,7 +177,7 @@ void NVIC_SetPriorityIRQ(NVIC_IRQType IRQ_Num, NVIC_IRQPriorityType IRQ_Priority
         (*NVIC_pri_reg_address) &= ~(MASK_3_BITS << pos_of_int_bit_int_pri_reg);
         (*NVIC_pri_reg_address) |= (IRQ_Priority << pos_of_int_bit_int_pri_reg);
     }
-
+    PROFILER_END(PROFILER_PROBE_NVIC_SET_PRIORITY_IRQ);
 }
 
 /*******************************************************************************
@@ -179,6 +216,7 @@ void NVIC_EnableException(NVIC_ExceptionType Exception_Num)
        break;
     default:
        /*DO NOTHING AS EXCEPTION NUM IS WRONG*/
+       LOG_1(LOG_LEVEL_WARNING, "NVIC_EnableException: exception %u has no enable bit", Exception_Num);
        break;
     }
 }
@@ -213,6 +251,7 @@ void NVIC_DisableException(NVIC_ExceptionType Exception_Num)
     break;
     default:
     /*DO NOTHING AS EXCEPTION NUM IS WRONG*/
+    LOG_1(LOG_LEVEL_WARNING, "NVIC_DisableException: exception %u has no enable bit", Exception_Num);
     break;
     }
 }
@@ -233,6 +272,7 @@ void NVIC_SetPriorityException(NVIC_ExceptionType Exception_Num, NVIC_ExceptionP
     if (Exception_Num > 15 || Exception_Priority > 7)
     {
         /*DO NOTHING THE EXCEPTION_NUM OR EXCEPTION_PRIORITY ARE WRONG*/
+        LOG_2(LOG_LEVEL_ERROR, "NVIC_SetPriorityException: invalid exception %u or priority %u", Exception_Num, Exception_Priority);
     }
     else
     {
@@ -266,4 +306,198 @@ void NVIC_SetPriorityException(NVIC_ExceptionType Exception_Num, NVIC_ExceptionP
     }
 }
 
+/*******************************************************************************
+ * Interrupt Rate Limiter Functions:
+ * functions to protect the system from interrupt storms (e.g. a noisy edge
+ * triggered input). After Max_Events in one window the IRQ is masked at its
+ * source (or at the NVIC), and it is re-armed by NVIC_RateLimitTick() after
+ * the hold-off time.
+ *******************************************************************************/
+/*********************************************************************
+* Service Name: NVIC_RateLimitInit
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - rate limiter channel number / Config_Ptr - pointer to the channel configuration
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to attach a rate limiter channel to an IRQ source and reset its counters.
+**********************************************************************/
+CODE_COLD void NVIC_RateLimitInit(NVIC_RateLimitChannelType Channel, const NVIC_RateLimitConfigType *Config_Ptr)
+{
+    if (Channel >= NVIC_RATE_LIMIT_MAX_CHANNELS)
+    {
+        /*WRONG CHANNEL NUM DO NOTHING*/
+        LOG_1(LOG_LEVEL_ERROR, "NVIC_RateLimitInit: invalid channel %u", Channel);
+    }
+    else
+    {
+        NVIC_RateLimitStateType *state_ptr = &g_RateLimitState[Channel];
+
+        state_ptr->Event_Count = 0;
+        state_ptr->Dropped_Count = 0;
+        state_ptr->Trip_Count = 0;
+        state_ptr->Window_Start_Count = 0;
+        state_ptr->Rearm_Count = 0;
+        state_ptr->Window_Elapsed = 0;
+        state_ptr->HoldOff_Elapsed = 0;
+        /*attach the configuration last, the tick ignores channels without configuration*/
+        state_ptr->Config_Ptr = Config_Ptr;
+    }
+}
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitEvent
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - rate limiter channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the event should be handled, FALSE if it was dropped
+* Description: Function to be called at the entry of the guarded ISR. It counts the event
+  and masks the IRQ when the window budget is exceeded. A dropped event still has to be
+  cleared at the peripheral by the ISR.
+**********************************************************************/
+RAMFUNC boolean NVIC_RateLimitEvent(NVIC_RateLimitChannelType Channel)
+{
+    NVIC_RateLimitStateType *state_ptr;
+    const NVIC_RateLimitConfigType *config_ptr;
+
+    if (Channel >= NVIC_RATE_LIMIT_MAX_CHANNELS || g_RateLimitState[Channel].Config_Ptr == NULL_PTR)
+    {
+        /*channel is not guarded, handle every event*/
+        return TRUE;
+    }
+
+    state_ptr = &g_RateLimitState[Channel];
+    config_ptr = state_ptr->Config_Ptr;
+    state_ptr->Event_Count++;
+
+    if (state_ptr->Trip_Count != state_ptr->Rearm_Count)
+    {
+        /*an event that was already latched when the source got masked*/
+        state_ptr->Dropped_Count++;
+        return FALSE;
+    }
+
+    if ((state_ptr->Event_Count - state_ptr->Window_Start_Count) > config_ptr->Max_Events)
+    {
+        /*budget of this window is exceeded, mask the IRQ until the tick re-arms it*/
+        if (config_ptr->Source_IM_Reg != NULL_PTR)
+        {
+            *(config_ptr->Source_IM_Reg) &= ~(config_ptr->Source_Mask);
+        }
+        else
+        {
+            NVIC_DisableIRQ(config_ptr->IRQ_Num);
+        }
+        state_ptr->Trip_Count++;
+        state_ptr->Dropped_Count++;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitTick
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to be called periodically from a timer (e.g. the SysTick call-back)
+  to restart the counting windows and re-arm the tripped IRQs after their hold-off time.
+  It must not be preempted by the guarded ISRs, so the timer priority must be higher.
+**********************************************************************/
+RAMFUNC void NVIC_RateLimitTick(void)
+{
+    uint8 channel;
 
+    for (channel = 0; channel < NVIC_RATE_LIMIT_MAX_CHANNELS; channel++)
+    {
+        NVIC_RateLimitStateType *state_ptr = &g_RateLimitState[channel];
+        const NVIC_RateLimitConfigType *config_ptr = state_ptr->Config_Ptr;
+
+        if (config_ptr == NULL_PTR)
+        {
+            continue;
+        }
+
+        if (state_ptr->Trip_Count != state_ptr->Rearm_Count)
+        {
+            /*channel is masked, wait for the hold-off time then re-arm it with a fresh window*/
+            state_ptr->HoldOff_Elapsed++;
+            if (state_ptr->HoldOff_Elapsed >= config_ptr->HoldOff_Ticks)
+            {
+                state_ptr->HoldOff_Elapsed = 0;
+                state_ptr->Window_Elapsed = 0;
+                state_ptr->Window_Start_Count = state_ptr->Event_Count;
+
+                if (config_ptr->Source_IM_Reg != NULL_PTR)
+                {
+                    /*flush the edges latched while masked before unmasking the source*/
+                    if (config_ptr->Source_ICR_Reg != NULL_PTR)
+                    {
+                        *(config_ptr->Source_ICR_Reg) = config_ptr->Source_Mask;
+                    }
+                    *(config_ptr->Source_IM_Reg) |= config_ptr->Source_Mask;
+                }
+                else
+                {
+                    NVIC_EnableIRQ(config_ptr->IRQ_Num);
+                }
+                state_ptr->Rearm_Count = state_ptr->Trip_Count;
+            }
+        }
+        else
+        {
+            /*channel is armed, start a new counting window when this one is over*/
+            state_ptr->Window_Elapsed++;
+            if (state_ptr->Window_Elapsed >= config_ptr->Window_Ticks)
+            {
+                state_ptr->Window_Elapsed = 0;
+                state_ptr->Window_Start_Count = state_ptr->Event_Count;
+            }
+        }
+    }
+}
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitGetDropCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - rate limiter channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of events dropped since initialization
+* Description: Function to read the number of dropped events of a channel.
+**********************************************************************/
+uint32 NVIC_RateLimitGetDropCount(NVIC_RateLimitChannelType Channel)
+{
+    if (Channel >= NVIC_RATE_LIMIT_MAX_CHANNELS)
+    {
+        return 0;
+    }
+    return g_RateLimitState[Channel].Dropped_Count;
+}
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitGetTripCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - rate limiter channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of times the IRQ was masked by the rate limiter
+* Description: Function to read the number of times a channel has been tripped.
+**********************************************************************/
+uint32 NVIC_RateLimitGetTripCount(NVIC_RateLimitChannelType Channel)
+{
+    if (Channel >= NVIC_RATE_LIMIT_MAX_CHANNELS)
+    {
+        return 0;
+    }
+    return g_RateLimitState[Channel].Trip_Count;
+}
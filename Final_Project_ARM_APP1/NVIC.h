@@ -48,6 +48,9 @@
 #define BUS_FAULT_ENABLE_MASK                0x00020000
 #define USAGE_FAULT_ENABLE_MASK              0x00040000
 
+/* Number of IRQ sources that can be guarded by the interrupt rate limiter */
+#define NVIC_RATE_LIMIT_MAX_CHANNELS         4
+
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
@@ -83,6 +86,22 @@ typedef enum
 
 typedef uint8 NVIC_ExceptionPriorityType;
 
+typedef uint8 NVIC_RateLimitChannelType;
+
+/* Rate limiter configuration of one IRQ source. The window and hold-off lengths are
+ * counted in calls of NVIC_RateLimitTick(), so their unit is the period of the timer
+ * that calls it. */
+typedef struct
+{
+    NVIC_IRQType IRQ_Num;               /* IRQ guarded by this channel */
+    volatile uint32 *Source_IM_Reg;     /* Peripheral interrupt mask register (e.g. GPIO_PORTF_IM_REG) or NULL_PTR to mask at the NVIC */
+    volatile uint32 *Source_ICR_Reg;    /* Peripheral interrupt clear register, flushed before the source is re-armed */
+    uint32 Source_Mask;                 /* Bits of the source owned by this channel (e.g. the pin mask) */
+    uint16 Max_Events;                  /* Number of events accepted in one window */
+    uint8 Window_Ticks;                 /* Length of the counting window in ticks */
+    uint8 HoldOff_Ticks;                /* Number of ticks the source stays masked after a trip */
+}NVIC_RateLimitConfigType;
+
 /*******************************************************************************
  *                            Functions Prototypes                             *
  *******************************************************************************/
@@ -181,6 +200,78 @@ void NVIC_DisableException(NVIC_ExceptionType Exception_Num);
 **********************************************************************/
 void NVIC_SetPriorityException(NVIC_ExceptionType Exception_Num, NVIC_ExceptionPriorityType Exception_Priority);
 
+/*******************************************************************************
+ * Interrupt Rate Limiter Functions:
+ * functions to protect the system from interrupt storms (e.g. a noisy edge
+ * triggered input). After Max_Events in one window the IRQ is masked at its
+ * source (or at the NVIC), and it is re-armed by NVIC_RateLimitTick() after
+ * the hold-off time.
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitInit
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - rate limiter channel number / Config_Ptr - pointer to the channel configuration
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to attach a rate limiter channel to an IRQ source and reset its counters.
+**********************************************************************/
+void NVIC_RateLimitInit(NVIC_RateLimitChannelType Channel, const NVIC_RateLimitConfigType *Config_Ptr);
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitEvent
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - rate limiter channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the event should be handled, FALSE if it was dropped
+* Description: Function to be called at the entry of the guarded ISR. It counts the event
+  and masks the IRQ when the window budget is exceeded. A dropped event still has to be
+  cleared at the peripheral by the ISR.
+**********************************************************************/
+boolean NVIC_RateLimitEvent(NVIC_RateLimitChannelType Channel);
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitTick
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to be called periodically from a timer (e.g. the SysTick call-back)
+  to restart the counting windows and re-arm the tripped IRQs after their hold-off time.
+  It must not be preempted by the guarded ISRs, so the timer priority must be higher.
+**********************************************************************/
+void NVIC_RateLimitTick(void);
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitGetDropCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - rate limiter channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of events dropped since initialization
+* Description: Function to read the number of dropped events of a channel.
+**********************************************************************/
+uint32 NVIC_RateLimitGetDropCount(NVIC_RateLimitChannelType Channel);
+
+/*********************************************************************
+* Service Name: NVIC_RateLimitGetTripCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - rate limiter channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of times the IRQ was masked by the rate limiter
+* Description: Function to read the number of times a channel has been tripped.
+**********************************************************************/
+uint32 NVIC_RateLimitGetTripCount(NVIC_RateLimitChannelType Channel);
+
 /************************************************************************************
  *                                 End of File                                      *
  ************************************************************************************/
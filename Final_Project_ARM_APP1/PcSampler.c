@@ -0,0 +1,162 @@
+ /******************************************************************************
+ *
+ * Module: PcSampler
+ *
+ * File Name: PcSampler.c
+ *
+ * Description: Source file for the statistical PC sampling profiler
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "PcSampler.h"
+#include "CodeLayout.h"
+#include "RamFunc.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define PCSAMPLER_BUCKET_MAX_COUNT           0xFFFFu
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* The histogram, left public in the map file so it can be dumped by name */
+PcSampler_HistogramType g_PcSampler_Histogram;
+
+static volatile boolean g_PcSampler_Running = FALSE;
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: PcSampler_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the histogram and fill its header. Sampling
+  stays stopped until PcSampler_Start() is called.
+**********************************************************************/
+void PcSampler_Init(void)
+{
+    uint16 bucket;
+    uint32 ram_buckets = (RamFunc_GetSize() + (1u << PCSAMPLER_BUCKET_SHIFT) - 1u) >> PCSAMPLER_BUCKET_SHIFT;
+
+    g_PcSampler_Running = FALSE;
+
+    g_PcSampler_Histogram.Magic = PCSAMPLER_MAGIC;
+    g_PcSampler_Histogram.Base_Address = PCSAMPLER_BASE_ADDRESS;
+    g_PcSampler_Histogram.Bucket_Shift = PCSAMPLER_BUCKET_SHIFT;
+    g_PcSampler_Histogram.Buckets_Num = PCSAMPLER_BUCKETS_NUM;
+    g_PcSampler_Histogram.Samples = 0;
+    g_PcSampler_Histogram.Outside = 0;
+    g_PcSampler_Histogram.Ram_Base_Address = RamFunc_GetRunAddress();
+    g_PcSampler_Histogram.Ram_Buckets_Num = (ram_buckets < PCSAMPLER_RAM_BUCKETS_NUM) ?
+                                            (uint16)ram_buckets : (uint16)PCSAMPLER_RAM_BUCKETS_NUM;
+    g_PcSampler_Histogram.Reserved = 0;
+    for (bucket = 0; bucket < PCSAMPLER_BUCKETS_NUM; bucket++)
+    {
+        g_PcSampler_Histogram.Buckets[bucket] = 0;
+    }
+    for (bucket = 0; bucket < PCSAMPLER_RAM_BUCKETS_NUM; bucket++)
+    {
+        g_PcSampler_Histogram.Ram_Buckets[bucket] = 0;
+    }
+}
+
+/*********************************************************************
+* Service Name: PcSampler_Start
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start counting the samples.
+**********************************************************************/
+void PcSampler_Start(void)
+{
+    g_PcSampler_Running = TRUE;
+}
+
+/*********************************************************************
+* Service Name: PcSampler_Stop
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop counting the samples, the histogram is kept.
+**********************************************************************/
+void PcSampler_Stop(void)
+{
+    g_PcSampler_Running = FALSE;
+}
+
+/*********************************************************************
+* Service Name: PcSampler_Sample
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Pc - interrupted program counter
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to count one sample, called from SysTick_Handler.
+**********************************************************************/
+CODE_HOT void PcSampler_Sample(uint32 Pc)
+{
+    /*unsigned subtraction, addresses below the base wrap to a huge bucket number*/
+    uint32 bucket = (Pc - PCSAMPLER_BASE_ADDRESS) >> PCSAMPLER_BUCKET_SHIFT;
+    uint32 ram_bucket;
+
+    if (!g_PcSampler_Running)
+    {
+        return;
+    }
+
+    g_PcSampler_Histogram.Samples++;
+    if (bucket < PCSAMPLER_BUCKETS_NUM)
+    {
+        if (g_PcSampler_Histogram.Buckets[bucket] != PCSAMPLER_BUCKET_MAX_COUNT)
+        {
+            g_PcSampler_Histogram.Buckets[bucket]++;
+        }
+    }
+    else
+    {
+        ram_bucket = (Pc - g_PcSampler_Histogram.Ram_Base_Address) >> PCSAMPLER_BUCKET_SHIFT;
+        if (ram_bucket < g_PcSampler_Histogram.Ram_Buckets_Num)
+        {
+            if (g_PcSampler_Histogram.Ram_Buckets[ram_bucket] != PCSAMPLER_BUCKET_MAX_COUNT)
+            {
+                g_PcSampler_Histogram.Ram_Buckets[ram_bucket]++;
+            }
+        }
+        else
+        {
+            g_PcSampler_Histogram.Outside++;
+        }
+    }
+}
+
+/*********************************************************************
+* Service Name: PcSampler_GetHistogram
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const PcSampler_HistogramType* - the histogram
+* Description: Function to access the histogram, to dump or to send it.
+**********************************************************************/
+const PcSampler_HistogramType* PcSampler_GetHistogram(void)
+{
+    return &g_PcSampler_Histogram;
+}
@@ -0,0 +1,134 @@
+ /******************************************************************************
+ *
+ * Module: PcSampler
+ *
+ * File Name: PcSampler.h
+ *
+ * Description: Header file for the statistical PC sampling profiler. On every
+ *              SysTick the interrupted PC is read from the exception stack frame
+ *              and counted in a histogram of fixed size address buckets, over
+ *              the flash and over the SRAM code of RamFunc. tools/pcsample_report.py
+ *              maps the buckets back to functions
+ *
+ *******************************************************************************/
+
+#ifndef PCSAMPLER_H_
+#define PCSAMPLER_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to TRUE to sample the PC in SysTick_Handler */
+#ifndef PCSAMPLER_ENABLE
+#define PCSAMPLER_ENABLE                     FALSE
+#endif
+
+/* Sampled address range: PCSAMPLER_BUCKETS_NUM buckets of 2^PCSAMPLER_BUCKET_SHIFT
+ * bytes from PCSAMPLER_BASE_ADDRESS, the default covers the whole 256 KB flash
+ * with 256 bytes buckets in 2 KB of SRAM */
+#define PCSAMPLER_BASE_ADDRESS               0x00000000u
+#define PCSAMPLER_BUCKET_SHIFT               8u
+#define PCSAMPLER_BUCKETS_NUM                1024u
+
+/* Buckets of the same size over the RAMFUNC code, from RamFunc_GetRunAddress(),
+ * the default covers the 4 KB SRAM_CODE range of tm4c123gh6pm.cmd */
+#define PCSAMPLER_RAM_BUCKETS_NUM            16u
+
+/* Marks the start of the histogram in a memory dump, "PCSM" */
+#define PCSAMPLER_MAGIC                      0x4D534350u
+
+/* Index of the stacked PC in the exception stack frame (R0-R3, R12, LR, PC, xPSR) */
+#define PCSAMPLER_FRAME_PC_INDEX             6u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* Histogram layout, read by tools/pcsample_report.py, keep both in sync */
+typedef struct
+{
+    uint32 Magic;
+    uint32 Base_Address;
+    uint16 Bucket_Shift;
+    uint16 Buckets_Num;
+    uint32 Samples;                            /* all samples, including the ones outside the range */
+    uint32 Outside;                            /* samples outside both sampled address ranges */
+    uint32 Ram_Base_Address;                   /* run address of the RAMFUNC code */
+    uint16 Ram_Buckets_Num;                    /* used Ram_Buckets, 0 without RAMFUNC code */
+    uint16 Reserved;
+    uint16 Buckets[PCSAMPLER_BUCKETS_NUM];     /* saturate at 0xFFFF */
+    uint16 Ram_Buckets[PCSAMPLER_RAM_BUCKETS_NUM];
+}PcSampler_HistogramType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: PcSampler_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the histogram and fill its header. Sampling
+  stays stopped until PcSampler_Start() is called.
+**********************************************************************/
+void PcSampler_Init(void);
+
+/*********************************************************************
+* Service Name: PcSampler_Start
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start counting the samples.
+**********************************************************************/
+void PcSampler_Start(void);
+
+/*********************************************************************
+* Service Name: PcSampler_Stop
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop counting the samples, the histogram is kept.
+**********************************************************************/
+void PcSampler_Stop(void);
+
+/*********************************************************************
+* Service Name: PcSampler_Sample
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Pc - interrupted program counter
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to count one sample, called from SysTick_Handler.
+**********************************************************************/
+void PcSampler_Sample(uint32 Pc);
+
+/*********************************************************************
+* Service Name: PcSampler_GetHistogram
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const PcSampler_HistogramType* - the histogram
+* Description: Function to access the histogram, to dump or to send it.
+**********************************************************************/
+const PcSampler_HistogramType* PcSampler_GetHistogram(void);
+
+#endif /* PCSAMPLER_H_ */
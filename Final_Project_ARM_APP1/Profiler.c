@@ -0,0 +1,249 @@
+ /******************************************************************************
+ *
+ * Module: Profiler
+ *
+ * File Name: Profiler.c
+ *
+ * Description: Source file for the DWT cycle counter profiler
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Profiler.h"
+#include "CodeLayout.h"
+#include "interruptsControl.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define PROFILER_DEMCR_TRCENA_MASK           0x01000000
+#define PROFILER_DWT_CTRL_CYCCNTENA_MASK     0x00000001
+#define PROFILER_OVERHEAD_TRIALS             8u
+
+/* Count leading zeros, a single CLZ instruction on the Cortex-M4 */
+#if defined(__TI_ARM__)
+#define PROFILER_CLZ(VALUE)                  ((uint32)_norm(VALUE))
+#else
+#define PROFILER_CLZ(VALUE)                  ((uint32)__builtin_clz(VALUE))
+#endif
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Measurements of all probes */
+static Profiler_ProbeType g_Profiler_Probes[PROFILER_PROBES_NUM];
+
+/* Printable probe names, must follow the order of Profiler_ProbeIdType */
+static const char * const g_Profiler_Names[PROFILER_PROBES_NUM] =
+{
+    "SysTick_Handler",
+    "NVIC_SetPriorityIRQ"
+};
+
+/* Cycles spent by an empty PROFILER_BEGIN / PROFILER_END pair */
+static uint32 g_Profiler_Overhead = 0;
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Profiler_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the DWT cycle counter, measure the cost of an
+  empty PROFILER_BEGIN / PROFILER_END pair and reset all probes. The measured
+  overhead is subtracted from every recorded duration.
+**********************************************************************/
+CODE_COLD void Profiler_Init(void)
+{
+    uint8 probe;
+    uint8 trial;
+    uint32 start;
+    uint32 cycles;
+
+    /* The DWT unit is only clocked when trace is enabled in the core debug block.
+     * The counter is not cleared, it has been counting from the reset for the boot profile */
+    CORE_DEBUG_DEMCR_REG |= PROFILER_DEMCR_TRCENA_MASK;
+    DWT_CTRL_REG |= PROFILER_DWT_CTRL_CYCCNTENA_MASK;
+
+    /* Keep the fastest of a few trials, slower ones were hit by an interrupt */
+    g_Profiler_Overhead = 0xFFFFFFFF;
+    for (trial = 0; trial < PROFILER_OVERHEAD_TRIALS; trial++)
+    {
+        start = PROFILER_NOW();
+        cycles = PROFILER_NOW() - start;
+        if (cycles < g_Profiler_Overhead)
+        {
+            g_Profiler_Overhead = cycles;
+        }
+    }
+
+    for (probe = 0; probe < PROFILER_PROBES_NUM; probe++)
+    {
+        Profiler_Reset((Profiler_ProbeIdType)probe);
+    }
+}
+
+/*********************************************************************
+* Service Name: Profiler_Record
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant for the same probe
+* Parameters (in): Probe_Id - ID of the probe / Cycles - measured duration in cycles
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to add one measured duration to a probe. It is called by
+  PROFILER_END, a probe must only be recorded from one interrupt priority level.
+**********************************************************************/
+CODE_HOT void Profiler_Record(Profiler_ProbeIdType Probe_Id, uint32 Cycles)
+{
+    Profiler_ProbeType *probe_ptr;
+    uint32 bin;
+
+    if (Probe_Id >= PROFILER_PROBES_NUM)
+    {
+        /*WRONG PROBE ID DO NOTHING*/
+        return;
+    }
+
+    probe_ptr = &g_Profiler_Probes[Probe_Id];
+    Cycles = (Cycles > g_Profiler_Overhead) ? (Cycles - g_Profiler_Overhead) : 0;
+
+    probe_ptr->Count++;
+    probe_ptr->Total_Cycles += Cycles;
+    if (Cycles < probe_ptr->Min_Cycles)
+    {
+        probe_ptr->Min_Cycles = Cycles;
+    }
+    if (Cycles > probe_ptr->Max_Cycles)
+    {
+        probe_ptr->Max_Cycles = Cycles;
+    }
+
+    /*bin is the number of significant bits of the duration*/
+    bin = (Cycles == 0) ? 0 : (32 - PROFILER_CLZ(Cycles));
+    if (bin >= PROFILER_HISTOGRAM_BINS)
+    {
+        bin = PROFILER_HISTOGRAM_BINS - 1;
+    }
+    probe_ptr->Histogram[bin]++;
+}
+
+/*********************************************************************
+* Service Name: Profiler_Reset
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear all the measurements of a probe.
+**********************************************************************/
+void Profiler_Reset(Profiler_ProbeIdType Probe_Id)
+{
+    Profiler_ProbeType *probe_ptr;
+    uint8 bin;
+
+    if (Probe_Id >= PROFILER_PROBES_NUM)
+    {
+        /*WRONG PROBE ID DO NOTHING*/
+        return;
+    }
+
+    probe_ptr = &g_Profiler_Probes[Probe_Id];
+    probe_ptr->Count = 0;
+    probe_ptr->Min_Cycles = 0xFFFFFFFF;
+    probe_ptr->Max_Cycles = 0;
+    probe_ptr->Total_Cycles = 0;
+    for (bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++)
+    {
+        probe_ptr->Histogram[bin] = 0;
+    }
+}
+
+/*********************************************************************
+* Service Name: Profiler_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): Stats_Ptr - count, min, max and mean of the probe
+* Return value: boolean - FALSE if the probe ID is wrong or nothing was recorded
+* Description: Function to read the summary of a probe. The counters are read
+  with the interrupts disabled, so a probe updated from an ISR is consistent.
+**********************************************************************/
+boolean Profiler_GetStats(Profiler_ProbeIdType Probe_Id, Profiler_StatsType *Stats_Ptr)
+{
+    const Profiler_ProbeType *probe_ptr;
+    uint64 total_cycles;
+    uint32 primask;
+
+    if (Probe_Id >= PROFILER_PROBES_NUM || Stats_Ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    probe_ptr = &g_Profiler_Probes[Probe_Id];
+
+    /*snapshot the counters, the 64-bit total takes two loads*/
+    primask = Interrupts_DisableSave();
+    Stats_Ptr->Count = probe_ptr->Count;
+    Stats_Ptr->Min_Cycles = probe_ptr->Min_Cycles;
+    Stats_Ptr->Max_Cycles = probe_ptr->Max_Cycles;
+    total_cycles = probe_ptr->Total_Cycles;
+    Interrupts_Restore(primask);
+
+    if (Stats_Ptr->Count == 0)
+    {
+        return FALSE;
+    }
+
+    Stats_Ptr->Mean_Cycles = (uint32)(total_cycles / Stats_Ptr->Count);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: Profiler_GetProbe
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const Profiler_ProbeType* - probe data or NULL_PTR for a wrong ID
+* Description: Function to access the full measurements of a probe, including
+  the histogram.
+**********************************************************************/
+const Profiler_ProbeType* Profiler_GetProbe(Profiler_ProbeIdType Probe_Id)
+{
+    if (Probe_Id >= PROFILER_PROBES_NUM)
+    {
+        return NULL_PTR;
+    }
+    return &g_Profiler_Probes[Probe_Id];
+}
+
+/*********************************************************************
+* Service Name: Profiler_GetName
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const char* - name of the probe or NULL_PTR for a wrong ID
+* Description: Function to get the printable name of a probe.
+**********************************************************************/
+const char* Profiler_GetName(Profiler_ProbeIdType Probe_Id)
+{
+    if (Probe_Id >= PROFILER_PROBES_NUM)
+    {
+        return NULL_PTR;
+    }
+    return g_Profiler_Names[Probe_Id];
+}
@@ -0,0 +1,164 @@
+ /******************************************************************************
+ *
+ * Module: Profiler
+ *
+ * File Name: Profiler.h
+ *
+ * Description: Header file for the DWT cycle counter profiler. Code regions are
+ *              timed with PROFILER_BEGIN / PROFILER_END and the durations are
+ *              aggregated per probe (count, min, max, mean and a log2 histogram)
+ *
+ *******************************************************************************/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to FALSE to compile every PROFILER_BEGIN / PROFILER_END out of the build */
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE                      TRUE
+#endif
+
+/* Number of histogram bins per probe. Bin 0 counts zero cycle durations and
+ * bin n counts durations from 2^(n-1) to (2^n)-1 cycles, the last bin also
+ * counts everything longer */
+#define PROFILER_HISTOGRAM_BINS              16u
+
+/* Current value of the free running cycle counter */
+#define PROFILER_NOW()                       (DWT_CYCCNT_REG)
+
+#if (PROFILER_ENABLE == TRUE)
+/* Open a timed region for probe PROBE_ID, must be closed by PROFILER_END in
+ * the same block */
+#define PROFILER_BEGIN(PROBE_ID)             uint32 Profiler_Start_##PROBE_ID = PROFILER_NOW()
+
+/* Close the timed region opened by PROFILER_BEGIN and record its duration */
+#define PROFILER_END(PROBE_ID)               Profiler_Record((PROBE_ID), PROFILER_NOW() - Profiler_Start_##PROBE_ID)
+#else
+#define PROFILER_BEGIN(PROBE_ID)
+#define PROFILER_END(PROBE_ID)
+#endif
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* Probe IDs, add new probes before PROFILER_PROBES_NUM and give them a name in
+ * the names table in Profiler.c */
+typedef enum
+{
+    PROFILER_PROBE_SYSTICK_HANDLER,
+    PROFILER_PROBE_NVIC_SET_PRIORITY_IRQ,
+    PROFILER_PROBES_NUM
+}Profiler_ProbeIdType;
+
+/* Aggregated measurements of one probe */
+typedef struct
+{
+    uint32 Count;
+    uint32 Min_Cycles;
+    uint32 Max_Cycles;
+    uint64 Total_Cycles;
+    uint32 Histogram[PROFILER_HISTOGRAM_BINS];
+}Profiler_ProbeType;
+
+/* Summary of one probe as returned by Profiler_GetStats */
+typedef struct
+{
+    uint32 Count;
+    uint32 Min_Cycles;
+    uint32 Max_Cycles;
+    uint32 Mean_Cycles;
+}Profiler_StatsType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Profiler_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the DWT cycle counter, measure the cost of an
+  empty PROFILER_BEGIN / PROFILER_END pair and reset all probes. The measured
+  overhead is subtracted from every recorded duration.
+**********************************************************************/
+void Profiler_Init(void);
+
+/*********************************************************************
+* Service Name: Profiler_Record
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant for the same probe
+* Parameters (in): Probe_Id - ID of the probe / Cycles - measured duration in cycles
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to add one measured duration to a probe. It is called by
+  PROFILER_END, a probe must only be recorded from one interrupt priority level.
+**********************************************************************/
+void Profiler_Record(Profiler_ProbeIdType Probe_Id, uint32 Cycles);
+
+/*********************************************************************
+* Service Name: Profiler_Reset
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear all the measurements of a probe.
+**********************************************************************/
+void Profiler_Reset(Profiler_ProbeIdType Probe_Id);
+
+/*********************************************************************
+* Service Name: Profiler_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): Stats_Ptr - count, min, max and mean of the probe
+* Return value: boolean - FALSE if the probe ID is wrong or nothing was recorded
+* Description: Function to read the summary of a probe. The counters are read
+  with the interrupts disabled, so a probe updated from an ISR is consistent.
+**********************************************************************/
+boolean Profiler_GetStats(Profiler_ProbeIdType Probe_Id, Profiler_StatsType *Stats_Ptr);
+
+/*********************************************************************
+* Service Name: Profiler_GetProbe
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const Profiler_ProbeType* - probe data or NULL_PTR for a wrong ID
+* Description: Function to access the full measurements of a probe, including
+  the histogram.
+**********************************************************************/
+const Profiler_ProbeType* Profiler_GetProbe(Profiler_ProbeIdType Probe_Id);
+
+/*********************************************************************
+* Service Name: Profiler_GetName
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Probe_Id - ID of the probe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: const char* - name of the probe or NULL_PTR for a wrong ID
+* Description: Function to get the printable name of a probe.
+**********************************************************************/
+const char* Profiler_GetName(Profiler_ProbeIdType Probe_Id);
+
+#endif /* PROFILER_H_ */
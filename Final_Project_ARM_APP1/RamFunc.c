@@ -0,0 +1,157 @@
+ /******************************************************************************
+ *
+ * Module: RamFunc
+ *
+ * File Name: RamFunc.c
+ *
+ * Description: Source file for the functions executed from SRAM
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "RamFunc.h"
+#include "interruptsControl.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define RAMFUNC_CRC32_POLYNOMIAL             0xEDB88320u
+
+/* The same kernel is compiled twice, once per placement */
+#define RAMFUNC_BENCHMARK_KERNEL(NAME, PLACEMENT)                             \
+    PLACEMENT uint32 NAME(const uint8 *Data_Ptr, uint32 Length)               \
+    {                                                                         \
+        uint32 crc = 0xFFFFFFFF;                                              \
+        uint8 bit;                                                            \
+        while (Length > 0)                                                    \
+        {                                                                     \
+            crc ^= *Data_Ptr++;                                               \
+            for (bit = 0; bit < 8; bit++)                                     \
+            {                                                                 \
+                if (crc & 1u)                                                 \
+                {                                                             \
+                    crc = (crc >> 1) ^ RAMFUNC_CRC32_POLYNOMIAL;              \
+                }                                                             \
+                else                                                          \
+                {                                                             \
+                    crc >>= 1;                                                \
+                }                                                             \
+            }                                                                 \
+            Length--;                                                         \
+        }                                                                     \
+        return ~crc;                                                          \
+    }
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Placement of the .ramfunc section, defined by the linker command file */
+extern uint32 __ramfunc_run_start;
+extern uint32 __ramfunc_size;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+#if (RAMFUNC_BENCHMARK == TRUE)
+
+/* Not static, so the optimizer keeps both copies out of line */
+RAMFUNC_BENCHMARK_KERNEL(RamFunc_KernelFlash, )
+RAMFUNC_BENCHMARK_KERNEL(RamFunc_KernelSram, RAMFUNC)
+
+static uint32 RamFunc_Time(uint32 (*Kernel_Ptr)(const uint8 *, uint32), const uint8 *Data_Ptr)
+{
+    uint32 best = 0xFFFFFFFF;
+    uint32 start;
+    uint32 cycles;
+    uint32 primask;
+    uint8 run;
+
+    for (run = 0; run < RAMFUNC_BENCHMARK_RUNS; run++)
+    {
+        primask = Interrupts_DisableSave();
+        start = DWT_CYCCNT_REG;
+        (void)Kernel_Ptr(Data_Ptr, RAMFUNC_BENCHMARK_DATA_SIZE);
+        cycles = DWT_CYCCNT_REG - start;
+        Interrupts_Restore(primask);
+
+        if (cycles < best)
+        {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+#endif
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: RamFunc_GetRunAddress
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - SRAM address of the .ramfunc section
+* Description: Function to read where the SRAM code runs, e.g. to make it
+  executable in the MPU.
+**********************************************************************/
+uint32 RamFunc_GetRunAddress(void)
+{
+    return (uint32)&__ramfunc_run_start;
+}
+
+/*********************************************************************
+* Service Name: RamFunc_GetSize
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - size of the .ramfunc section in bytes
+* Description: Function to read the size of the SRAM code.
+**********************************************************************/
+uint32 RamFunc_GetSize(void)
+{
+    return (uint32)&__ramfunc_size;
+}
+
+#if (RAMFUNC_BENCHMARK == TRUE)
+/*********************************************************************
+* Service Name: RamFunc_Benchmark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - cycles of the kernel from the flash and from SRAM
+* Return value: None
+* Description: Function to time a branchy kernel (a bitwise CRC-32) linked once
+  in the flash and once in SRAM, with interrupts disabled. The flash has no wait
+  states up to 40 MHz, the difference shows at higher system clocks.
+**********************************************************************/
+void RamFunc_Benchmark(RamFunc_BenchmarkReportType *Report_Ptr)
+{
+    uint8 data[RAMFUNC_BENCHMARK_DATA_SIZE];
+    uint8 index;
+
+    if (Report_Ptr == NULL_PTR)
+    {
+        /*WRONG REPORT POINTER DO NOTHING*/
+        return;
+    }
+
+    for (index = 0; index < RAMFUNC_BENCHMARK_DATA_SIZE; index++)
+    {
+        data[index] = (uint8)(index * 37u + 11u);
+    }
+
+    Report_Ptr->Flash_Cycles = RamFunc_Time(RamFunc_KernelFlash, data);
+    Report_Ptr->Sram_Cycles = RamFunc_Time(RamFunc_KernelSram, data);
+}
+#endif
@@ -0,0 +1,106 @@
+ /******************************************************************************
+ *
+ * Module: RamFunc
+ *
+ * File Name: RamFunc.h
+ *
+ * Description: Header file for the functions executed from SRAM. A function
+ *              tagged with RAMFUNC is linked to run from the .ramfunc section
+ *              in SRAM and copied there from the flash at startup, which avoids
+ *              the flash wait states at high system clocks
+ *
+ *******************************************************************************/
+
+#ifndef RAMFUNC_H_
+#define RAMFUNC_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to FALSE to link every RAMFUNC function in the flash. Pass the same define
+ * to the linker, tm4c123gh6pm.cmd then gives the SRAM_CODE range back to SRAM */
+#ifndef RAMFUNC_ENABLE
+#define RAMFUNC_ENABLE                       TRUE
+#endif
+
+/* Set to TRUE to compare the same kernel running from the flash and from SRAM */
+#ifndef RAMFUNC_BENCHMARK
+#define RAMFUNC_BENCHMARK                    FALSE
+#endif
+
+/* Put before the return type of a function definition. Calls between the SRAM and
+ * the flash are out of BL range, the linker routes them through veneers. Without
+ * RAMFUNC_ENABLE the functions stay with the hot flash code. */
+#if (RAMFUNC_ENABLE == TRUE)
+#define RAMFUNC                              __attribute__((section(".ramfunc")))
+#else
+#define RAMFUNC                              CODE_HOT
+#endif
+
+/* Kernel runs of the benchmark, the fastest one is reported */
+#define RAMFUNC_BENCHMARK_RUNS               16u
+#define RAMFUNC_BENCHMARK_DATA_SIZE          64u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 Flash_Cycles;
+    uint32 Sram_Cycles;
+}RamFunc_BenchmarkReportType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: RamFunc_GetRunAddress
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - SRAM address of the .ramfunc section
+* Description: Function to read where the SRAM code runs, e.g. to make it
+  executable in the MPU.
+**********************************************************************/
+uint32 RamFunc_GetRunAddress(void);
+
+/*********************************************************************
+* Service Name: RamFunc_GetSize
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - size of the .ramfunc section in bytes
+* Description: Function to read the size of the SRAM code.
+**********************************************************************/
+uint32 RamFunc_GetSize(void);
+
+#if (RAMFUNC_BENCHMARK == TRUE)
+/*********************************************************************
+* Service Name: RamFunc_Benchmark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - cycles of the kernel from the flash and from SRAM
+* Return value: None
+* Description: Function to time a branchy kernel (a bitwise CRC-32) linked once
+  in the flash and once in SRAM, with interrupts disabled. The flash has no wait
+  states up to 40 MHz, the difference shows at higher system clocks.
+**********************************************************************/
+void RamFunc_Benchmark(RamFunc_BenchmarkReportType *Report_Ptr);
+#endif
+
+#endif /* RAMFUNC_H_ */
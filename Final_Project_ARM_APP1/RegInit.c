@@ -0,0 +1,56 @@
+ /******************************************************************************
+ *
+ * Module: RegInit
+ *
+ * File Name: RegInit.c
+ *
+ * Description: Source file for the table driven register initialization engine
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "RegInit.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: RegInit_Execute
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Steps_Ptr - pointer to the first step of the sequence / Steps_Num - number of steps
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to execute a constant initialization sequence in order.
+**********************************************************************/
+CODE_COLD void RegInit_Execute(const RegInit_StepType *Steps_Ptr, uint16 Steps_Num)
+{
+    while (Steps_Num > 0)
+    {
+        volatile uint32 *reg_ptr = (volatile uint32 *)(Steps_Ptr->Target & ~REGINIT_OP_MASK);
+
+        switch (Steps_Ptr->Target & REGINIT_OP_MASK)
+        {
+        case REGINIT_OP_MODIFY:
+            *reg_ptr = (*reg_ptr & ~(Steps_Ptr->Clear_Mask)) | Steps_Ptr->Set_Mask;
+            break;
+        case REGINIT_OP_WRITE:
+            *reg_ptr = Steps_Ptr->Set_Mask;
+            break;
+        case REGINIT_OP_WAIT_SET:
+            while ((*reg_ptr & Steps_Ptr->Set_Mask) != Steps_Ptr->Set_Mask);
+            break;
+        default:
+            /*DO NOTHING AS THE STEP OPERATION IS WRONG*/
+            break;
+        }
+
+        Steps_Ptr++;
+        Steps_Num--;
+    }
+}
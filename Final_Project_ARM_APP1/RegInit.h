@@ -0,0 +1,68 @@
+ /******************************************************************************
+ *
+ * Module: RegInit
+ *
+ * File Name: RegInit.h
+ *
+ * Description: Header file for the table driven register initialization engine
+ *
+ *******************************************************************************/
+
+#ifndef REGINIT_H_
+#define REGINIT_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Step operations, kept in the two low bits of the (word aligned) register address */
+#define REGINIT_OP_MODIFY                    0x0u   /* REG = (REG & ~Clear_Mask) | Set_Mask */
+#define REGINIT_OP_WRITE                     0x1u   /* REG = Set_Mask, without reading REG first */
+#define REGINIT_OP_WAIT_SET                  0x2u   /* wait until all Set_Mask bits read as 1 */
+#define REGINIT_OP_MASK                      0x3u
+
+/* Step constructors, REG is one of the register macros of tm4c123gh6pm_registers.h.
+ * Each register should appear once per table: merge the masks of all pins sharing
+ * a register into a single step (the masks are constant expressions, so the merge
+ * costs nothing at run time). */
+#define REGINIT_MODIFY(REG, CLEAR, SET)      { ((uint32)&(REG)) | REGINIT_OP_MODIFY, (CLEAR), (SET) }
+#define REGINIT_WRITE(REG, VALUE)            { ((uint32)&(REG)) | REGINIT_OP_WRITE, 0xFFFFFFFF, (VALUE) }
+#define REGINIT_WAIT_SET(REG, MASK)          { ((uint32)&(REG)) | REGINIT_OP_WAIT_SET, 0, (MASK) }
+
+/* Number of steps of a table */
+#define REGINIT_STEPS_NUM(TABLE)             ((uint16)(sizeof(TABLE) / sizeof((TABLE)[0])))
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+
+/* One 12 bytes step of an initialization sequence */
+typedef struct
+{
+    uint32 Target;          /* Register address ORed with the step operation */
+    uint32 Clear_Mask;      /* Bits to clear (REGINIT_OP_MODIFY) */
+    uint32 Set_Mask;        /* Bits to set, value to write or bits to wait for */
+}RegInit_StepType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: RegInit_Execute
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Steps_Ptr - pointer to the first step of the sequence / Steps_Num - number of steps
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to execute a constant initialization sequence in order.
+**********************************************************************/
+void RegInit_Execute(const RegInit_StepType *Steps_Ptr, uint16 Steps_Num);
+
+#endif /* REGINIT_H_ */
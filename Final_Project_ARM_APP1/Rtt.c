@@ -0,0 +1,239 @@
+ /******************************************************************************
+ *
+ * Module: Rtt
+ *
+ * File Name: Rtt.c
+ *
+ * Description: Source file for the memory resident log channels
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Rtt.h"
+#include "interruptsControl.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* The control block, the probe finds it by scanning SRAM for its ID */
+Rtt_ControlBlockType g_Rtt_ControlBlock;
+
+static uint8 g_Rtt_TerminalUpBuffer[RTT_TERMINAL_UP_BUFFER_SIZE];
+static uint8 g_Rtt_BinaryUpBuffer[RTT_BINARY_UP_BUFFER_SIZE];
+static uint8 g_Rtt_TerminalDownBuffer[RTT_TERMINAL_DOWN_BUFFER_SIZE];
+
+/* ID copied to the control block at run time only, so no stale copy of a
+ * complete ID exists in SRAM before Rtt_Init() */
+static const char g_Rtt_Id[] = "SEGGER RTT";
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+static void Rtt_InitBuffer(Rtt_BufferType *Buffer_Ptr, const char *Name_Ptr, uint8 *Data_Ptr, uint32 Size)
+{
+    Buffer_Ptr->Name = Name_Ptr;
+    Buffer_Ptr->Buffer = Data_Ptr;
+    Buffer_Ptr->Size = Size;
+    Buffer_Ptr->Write_Offset = 0;
+    Buffer_Ptr->Read_Offset = 0;
+    Buffer_Ptr->Flags = RTT_MODE_SKIP;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Rtt_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set up the control block and empty all channels.
+  The ID is written last, so a probe never finds a half built control block.
+**********************************************************************/
+CODE_COLD void Rtt_Init(void)
+{
+    volatile char *id_ptr = g_Rtt_ControlBlock.Id;
+    uint8 i;
+
+    g_Rtt_ControlBlock.Up_Buffers_Num = RTT_UP_CHANNELS_NUM;
+    g_Rtt_ControlBlock.Down_Buffers_Num = RTT_DOWN_CHANNELS_NUM;
+    Rtt_InitBuffer(&g_Rtt_ControlBlock.Up[RTT_CHANNEL_TERMINAL], "Terminal",
+                   g_Rtt_TerminalUpBuffer, RTT_TERMINAL_UP_BUFFER_SIZE);
+    Rtt_InitBuffer(&g_Rtt_ControlBlock.Up[RTT_CHANNEL_BINARY], "Binary",
+                   g_Rtt_BinaryUpBuffer, RTT_BINARY_UP_BUFFER_SIZE);
+    Rtt_InitBuffer(&g_Rtt_ControlBlock.Down[RTT_CHANNEL_TERMINAL], "Terminal",
+                   g_Rtt_TerminalDownBuffer, RTT_TERMINAL_DOWN_BUFFER_SIZE);
+
+    /* Clear the ID, then write it back to front so it only matches once complete */
+    for (i = 0; i < RTT_ID_SIZE; i++)
+    {
+        id_ptr[i] = 0;
+    }
+    for (i = sizeof(g_Rtt_Id) - 1; i > 0; i--)
+    {
+        id_ptr[i - 1] = g_Rtt_Id[i - 1];
+    }
+}
+
+/*********************************************************************
+* Service Name: Rtt_SetMode
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - up channel / Mode - behaviour when the buffer is full
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to choose between dropping and trimming the writes that
+  do not fit in an up channel.
+**********************************************************************/
+void Rtt_SetMode(uint8 Channel, Rtt_ModeType Mode)
+{
+    if (Channel >= RTT_UP_CHANNELS_NUM)
+    {
+        /*WRONG CHANNEL DO NOTHING*/
+        return;
+    }
+    g_Rtt_ControlBlock.Up[Channel].Flags = Mode;
+}
+
+/*********************************************************************
+* Service Name: Rtt_Write
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - up channel / Data_Ptr - bytes to send / Size - number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bytes written
+* Description: Function to copy bytes to an up channel without blocking.
+  Concurrent writers to the same channel are serialized with interrupts masked
+  for the copy.
+**********************************************************************/
+CODE_HOT uint32 Rtt_Write(uint8 Channel, const uint8 *Data_Ptr, uint32 Size)
+{
+    Rtt_BufferType *buffer_ptr;
+    uint32 primask;
+    uint32 read_offset;
+    uint32 write_offset;
+    uint32 free_bytes;
+    uint32 i;
+
+    if (Channel >= RTT_UP_CHANNELS_NUM || Data_Ptr == NULL_PTR)
+    {
+        return 0;
+    }
+
+    buffer_ptr = &g_Rtt_ControlBlock.Up[Channel];
+    if (buffer_ptr->Size == 0)
+    {
+        /*NOT INITIALIZED YET DROP THE DATA*/
+        return 0;
+    }
+    primask = Interrupts_DisableSave();
+
+    /*the host may move Read_Offset at any time, take one snapshot*/
+    read_offset = buffer_ptr->Read_Offset;
+    write_offset = buffer_ptr->Write_Offset;
+    if (read_offset > write_offset)
+    {
+        free_bytes = read_offset - write_offset - 1;
+    }
+    else
+    {
+        free_bytes = buffer_ptr->Size - (write_offset - read_offset) - 1;
+    }
+
+    if (Size > free_bytes)
+    {
+        Size = (buffer_ptr->Flags == RTT_MODE_TRIM) ? free_bytes : 0;
+    }
+
+    for (i = 0; i < Size; i++)
+    {
+        buffer_ptr->Buffer[write_offset++] = Data_Ptr[i];
+        if (write_offset == buffer_ptr->Size)
+        {
+            write_offset = 0;
+        }
+    }
+
+    /* Publish the data to the host only once it is all in the buffer: the
+     * buffer stores are not volatile, the DMB keeps them before the offset */
+    __asm(" DMB");
+    buffer_ptr->Write_Offset = write_offset;
+
+    Interrupts_Restore(primask);
+    return Size;
+}
+
+/*********************************************************************
+* Service Name: Rtt_WriteString
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - up channel / String_Ptr - null terminated string
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bytes written
+* Description: Function to copy a string to an up channel without blocking.
+**********************************************************************/
+uint32 Rtt_WriteString(uint8 Channel, const char *String_Ptr)
+{
+    uint32 length = 0;
+
+    if (String_Ptr == NULL_PTR)
+    {
+        return 0;
+    }
+    while (String_Ptr[length] != '\0')
+    {
+        length++;
+    }
+    return Rtt_Write(Channel, (const uint8 *)String_Ptr, length);
+}
+
+/*********************************************************************
+* Service Name: Rtt_Read
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - down channel / Size - size of the destination buffer
+* Parameters (inout): None
+* Parameters (out): Data_Ptr - received bytes
+* Return value: uint32 - number of bytes read, 0 if nothing was received
+* Description: Function to take the bytes written by the host to a down channel.
+**********************************************************************/
+uint32 Rtt_Read(uint8 Channel, uint8 *Data_Ptr, uint32 Size)
+{
+    Rtt_BufferType *buffer_ptr;
+    uint32 read_offset;
+    uint32 write_offset;
+    uint32 count = 0;
+
+    if (Channel >= RTT_DOWN_CHANNELS_NUM || Data_Ptr == NULL_PTR)
+    {
+        return 0;
+    }
+
+    buffer_ptr = &g_Rtt_ControlBlock.Down[Channel];
+    read_offset = buffer_ptr->Read_Offset;
+    write_offset = buffer_ptr->Write_Offset;
+    while (read_offset != write_offset && count < Size)
+    {
+        Data_Ptr[count++] = buffer_ptr->Buffer[read_offset++];
+        if (read_offset == buffer_ptr->Size)
+        {
+            read_offset = 0;
+        }
+    }
+    /* The bytes are read before the host may overwrite them */
+    __asm(" DMB");
+    buffer_ptr->Read_Offset = read_offset;
+
+    return count;
+}
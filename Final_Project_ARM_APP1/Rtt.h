@@ -0,0 +1,144 @@
+ /******************************************************************************
+ *
+ * Module: Rtt
+ *
+ * File Name: Rtt.h
+ *
+ * Description: Header file for the memory resident log channels. The control
+ *              block follows the SEGGER RTT layout, so a J-Link or any RTT
+ *              aware probe (OpenOCD, pyOCD, probe-rs) finds it in SRAM and
+ *              reads the up buffers while the core keeps running. The target
+ *              side never blocks
+ *
+ *******************************************************************************/
+
+#ifndef RTT_H_
+#define RTT_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Up (target to host) and down (host to target) channels */
+#define RTT_UP_CHANNELS_NUM                  2u
+#define RTT_DOWN_CHANNELS_NUM                1u
+
+#define RTT_CHANNEL_TERMINAL                 0u    /* text, up and down */
+#define RTT_CHANNEL_BINARY                   1u    /* raw words, up only */
+
+#define RTT_TERMINAL_UP_BUFFER_SIZE          256u
+#define RTT_BINARY_UP_BUFFER_SIZE            512u
+#define RTT_TERMINAL_DOWN_BUFFER_SIZE        16u
+
+/* Control block ID searched by the probe */
+#define RTT_ID_SIZE                          16u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* What an up channel does with a write that does not fit, values of the RTT
+ * Flags field */
+typedef enum
+{
+    RTT_MODE_SKIP = 0,   /* drop the whole write */
+    RTT_MODE_TRIM = 1    /* write what fits and drop the rest */
+}Rtt_ModeType;
+
+/* One ring buffer, same layout as SEGGER_RTT_BUFFER_UP / _DOWN. The writer
+ * owns Write_Offset and the reader owns Read_Offset, the buffer is empty when
+ * they are equal and one byte always stays free */
+typedef struct
+{
+    const char *Name;
+    uint8 *Buffer;
+    uint32 Size;
+    volatile uint32 Write_Offset;
+    volatile uint32 Read_Offset;
+    uint32 Flags;
+}Rtt_BufferType;
+
+/* Same layout as SEGGER_RTT_CB */
+typedef struct
+{
+    char Id[RTT_ID_SIZE];
+    sint32 Up_Buffers_Num;
+    sint32 Down_Buffers_Num;
+    Rtt_BufferType Up[RTT_UP_CHANNELS_NUM];
+    Rtt_BufferType Down[RTT_DOWN_CHANNELS_NUM];
+}Rtt_ControlBlockType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Rtt_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set up the control block and empty all channels.
+  The ID is written last, so a probe never finds a half built control block.
+**********************************************************************/
+void Rtt_Init(void);
+
+/*********************************************************************
+* Service Name: Rtt_SetMode
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - up channel / Mode - behaviour when the buffer is full
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to choose between dropping and trimming the writes that
+  do not fit in an up channel.
+**********************************************************************/
+void Rtt_SetMode(uint8 Channel, Rtt_ModeType Mode);
+
+/*********************************************************************
+* Service Name: Rtt_Write
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - up channel / Data_Ptr - bytes to send / Size - number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bytes written
+* Description: Function to copy bytes to an up channel without blocking.
+  Concurrent writers to the same channel are serialized with interrupts masked
+  for the copy.
+**********************************************************************/
+uint32 Rtt_Write(uint8 Channel, const uint8 *Data_Ptr, uint32 Size);
+
+/*********************************************************************
+* Service Name: Rtt_WriteString
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - up channel / String_Ptr - null terminated string
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bytes written
+* Description: Function to copy a string to an up channel without blocking.
+**********************************************************************/
+uint32 Rtt_WriteString(uint8 Channel, const char *String_Ptr);
+
+/*********************************************************************
+* Service Name: Rtt_Read
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - down channel / Size - size of the destination buffer
+* Parameters (inout): None
+* Parameters (out): Data_Ptr - received bytes
+* Return value: uint32 - number of bytes read, 0 if nothing was received
+* Description: Function to take the bytes written by the host to a down channel.
+**********************************************************************/
+uint32 Rtt_Read(uint8 Channel, uint8 *Data_Ptr, uint32 Size);
+
+#endif /* RTT_H_ */
@@ -0,0 +1,255 @@
+ /******************************************************************************
+ *
+ * Module: StackMonitor
+ *
+ * File Name: StackMonitor.c
+ *
+ * Description: Source file for the stack high-water mark monitor
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "StackMonitor.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                           Private Data Types                                *
+ *******************************************************************************/
+
+/* Every word in [Bottom_Ptr, Mark_Ptr) still holds the pattern as far as the
+ * scanner knows, Mark_Ptr only moves down. Scan_Ptr is the next word to check. */
+typedef struct
+{
+    const char *Name;
+    uint32 *Bottom_Ptr;
+    uint32 *Top_Ptr;
+    uint32 *Mark_Ptr;
+    uint32 *Scan_Ptr;
+    boolean Scan_Confirmed;
+}StackMonitor_StackType;
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Bottom of the .stack section and the initial MSP of the vector table, defined
+ * by the linker command file. The top is the value the core loads at reset, not
+ * __STACK_END: the two differ when --stack_size is not 512 */
+extern uint32 __stack;
+extern uint32 __STACK_TOP;
+
+static StackMonitor_StackType g_Stacks[STACKMONITOR_MAX_STACKS];
+static uint8 g_Stacks_Num = 0;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Current value of the stack pointer */
+uint32 *StackMonitor_GetSP(void);
+
+__asm("    .sect \".text:StackMonitor_GetSP\"\n"
+      "    .clink\n"
+      "    .thumbfunc StackMonitor_GetSP\n"
+      "    .thumb\n"
+      "    .global StackMonitor_GetSP\n"
+      "StackMonitor_GetSP:\n"
+      "    mov     r0, sp\n"
+      "    bx      lr\n");
+
+static StackMonitor_IdType StackMonitor_Add(const char *Name_Ptr, uint32 *Bottom_Ptr, uint32 *Top_Ptr, uint32 *Paint_End_Ptr)
+{
+    StackMonitor_StackType *stack_ptr;
+    uint32 *word_ptr;
+
+    if (g_Stacks_Num >= STACKMONITOR_MAX_STACKS)
+    {
+        return STACKMONITOR_INVALID_ID;
+    }
+
+    for (word_ptr = Bottom_Ptr; word_ptr < Paint_End_Ptr; word_ptr++)
+    {
+        *word_ptr = STACKMONITOR_PAINT_PATTERN;
+    }
+
+    stack_ptr = &g_Stacks[g_Stacks_Num];
+    stack_ptr->Name = Name_Ptr;
+    stack_ptr->Bottom_Ptr = Bottom_Ptr;
+    stack_ptr->Top_Ptr = Top_Ptr;
+    stack_ptr->Mark_Ptr = Paint_End_Ptr;
+    stack_ptr->Scan_Ptr = Bottom_Ptr;
+    stack_ptr->Scan_Confirmed = FALSE;
+
+    return g_Stacks_Num++;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: StackMonitor_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to register the main stack, from the .stack section
+  up to the initial MSP, and paint it from its bottom up to a small margin
+  below the current SP. It should be called as early as possible in main().
+**********************************************************************/
+CODE_COLD void StackMonitor_Init(void)
+{
+    uint32 *paint_end_ptr = StackMonitor_GetSP() - (STACKMONITOR_PAINT_MARGIN_BYTES / sizeof(uint32));
+
+    g_Stacks_Num = 0;
+    if (paint_end_ptr < &__stack)
+    {
+        paint_end_ptr = &__stack;
+    }
+    (void)StackMonitor_Add("MSP", &__stack, &__STACK_TOP, paint_end_ptr);
+}
+
+/*********************************************************************
+* Service Name: StackMonitor_Register
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Name_Ptr - stack name / Bottom_Ptr - lowest address / Size_Bytes - stack size
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StackMonitor_IdType - ID of the stack or STACKMONITOR_INVALID_ID
+* Description: Function to monitor a stack that is not in use yet, e.g. a
+  task stack. The whole stack is painted.
+**********************************************************************/
+StackMonitor_IdType StackMonitor_Register(const char *Name_Ptr, uint32 *Bottom_Ptr, uint32 Size_Bytes)
+{
+    uint32 *top_ptr;
+
+    if (Bottom_Ptr == NULL_PTR || Size_Bytes < sizeof(uint32))
+    {
+        return STACKMONITOR_INVALID_ID;
+    }
+
+    top_ptr = Bottom_Ptr + (Size_Bytes / sizeof(uint32));
+    return StackMonitor_Add(Name_Ptr, Bottom_Ptr, top_ptr, top_ptr);
+}
+
+/*********************************************************************
+* Service Name: StackMonitor_SetLowerLimit
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Stack_Id - ID of the stack / Limit_Ptr - lowest address the monitor may read
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to keep the scanner away from the bottom of a stack,
+  e.g. when an MPU guard region was placed there.
+**********************************************************************/
+void StackMonitor_SetLowerLimit(StackMonitor_IdType Stack_Id, uint32 *Limit_Ptr)
+{
+    StackMonitor_StackType *stack_ptr;
+
+    if (Stack_Id >= g_Stacks_Num)
+    {
+        /*WRONG STACK ID DO NOTHING*/
+        return;
+    }
+
+    stack_ptr = &g_Stacks[Stack_Id];
+    if (Limit_Ptr <= stack_ptr->Bottom_Ptr || Limit_Ptr > stack_ptr->Top_Ptr)
+    {
+        /*OUTSIDE THE STACK DO NOTHING*/
+        return;
+    }
+
+    stack_ptr->Bottom_Ptr = Limit_Ptr;
+    if (stack_ptr->Mark_Ptr < Limit_Ptr)
+    {
+        stack_ptr->Mark_Ptr = Limit_Ptr;
+    }
+    stack_ptr->Scan_Ptr = Limit_Ptr;
+    stack_ptr->Scan_Confirmed = FALSE;
+}
+
+/*********************************************************************
+* Service Name: StackMonitor_Poll
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to check the next STACKMONITOR_SCAN_CHUNK_WORDS words
+  of every stack, to be called from the idle loop.
+**********************************************************************/
+CODE_HOT void StackMonitor_Poll(void)
+{
+    StackMonitor_StackType *stack_ptr;
+    uint32 *scan_ptr;
+    uint32 *chunk_end_ptr;
+    uint8 id;
+
+    for (id = 0; id < g_Stacks_Num; id++)
+    {
+        stack_ptr = &g_Stacks[id];
+        scan_ptr = stack_ptr->Scan_Ptr;
+        chunk_end_ptr = scan_ptr + STACKMONITOR_SCAN_CHUNK_WORDS;
+        if (chunk_end_ptr > stack_ptr->Mark_Ptr)
+        {
+            chunk_end_ptr = stack_ptr->Mark_Ptr;
+        }
+
+        while (scan_ptr < chunk_end_ptr && *scan_ptr == STACKMONITOR_PAINT_PATTERN)
+        {
+            scan_ptr++;
+        }
+
+        if (scan_ptr < chunk_end_ptr)
+        {
+            /*overwritten word below the mark, the stack grew deeper: new mark, new pass*/
+            stack_ptr->Mark_Ptr = scan_ptr;
+            stack_ptr->Scan_Ptr = stack_ptr->Bottom_Ptr;
+            stack_ptr->Scan_Confirmed = FALSE;
+        }
+        else if (scan_ptr >= stack_ptr->Mark_Ptr)
+        {
+            /*whole pass clean, the mark is the high-water mark*/
+            stack_ptr->Scan_Ptr = stack_ptr->Bottom_Ptr;
+            stack_ptr->Scan_Confirmed = TRUE;
+        }
+        else
+        {
+            stack_ptr->Scan_Ptr = scan_ptr;
+        }
+    }
+}
+
+/*********************************************************************
+* Service Name: StackMonitor_GetReport
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Stack_Id - ID of the stack
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - size and usage of the stack
+* Return value: boolean - FALSE if the ID is wrong
+* Description: Function to read the high-water mark of a stack.
+**********************************************************************/
+boolean StackMonitor_GetReport(StackMonitor_IdType Stack_Id, StackMonitor_ReportType *Report_Ptr)
+{
+    const StackMonitor_StackType *stack_ptr;
+
+    if (Stack_Id >= g_Stacks_Num || Report_Ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    stack_ptr = &g_Stacks[Stack_Id];
+    Report_Ptr->Name = stack_ptr->Name;
+    Report_Ptr->Size_Bytes = (uint32)(stack_ptr->Top_Ptr - stack_ptr->Bottom_Ptr) * sizeof(uint32);
+    Report_Ptr->Peak_Used_Bytes = (uint32)(stack_ptr->Top_Ptr - stack_ptr->Mark_Ptr) * sizeof(uint32);
+    Report_Ptr->Free_Bytes = Report_Ptr->Size_Bytes - Report_Ptr->Peak_Used_Bytes;
+    Report_Ptr->Scan_Confirmed = stack_ptr->Scan_Confirmed;
+    return TRUE;
+}
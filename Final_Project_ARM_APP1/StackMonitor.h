@@ -0,0 +1,127 @@
+ /******************************************************************************
+ *
+ * Module: StackMonitor
+ *
+ * File Name: StackMonitor.h
+ *
+ * Description: Header file for the stack high-water mark monitor. The unused
+ *              part of every monitored stack is painted with a known pattern,
+ *              and StackMonitor_Poll() looks for the lowest overwritten word a
+ *              small chunk at a time from the idle loop
+ *
+ *******************************************************************************/
+
+#ifndef STACKMONITOR_H_
+#define STACKMONITOR_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Main stack (MSP) plus future task stacks */
+#define STACKMONITOR_MAX_STACKS              4u
+
+/* The MSP is always registered first by StackMonitor_Init() */
+#define STACKMONITOR_MSP_ID                  0u
+
+/* Returned by StackMonitor_Register() when no slot is left */
+#define STACKMONITOR_INVALID_ID              0xFFu
+
+#define STACKMONITOR_PAINT_PATTERN           0xA5A5A5A5u
+
+/* Words checked per stack on every StackMonitor_Poll() call */
+#define STACKMONITOR_SCAN_CHUNK_WORDS        16u
+
+/* Bytes left unpainted below the live SP when the MSP is painted */
+#define STACKMONITOR_PAINT_MARGIN_BYTES      64u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef uint8 StackMonitor_IdType;
+
+typedef struct
+{
+    const char *Name;
+    uint32 Size_Bytes;
+    uint32 Peak_Used_Bytes;    /* from the top to the lowest overwritten word found so far */
+    uint32 Free_Bytes;
+    boolean Scan_Confirmed;    /* a full pass found nothing deeper than Peak_Used_Bytes */
+}StackMonitor_ReportType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: StackMonitor_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to register the main stack, from the .stack section
+  up to the initial MSP, and paint it from its bottom up to a small margin
+  below the current SP. It should be called as early as possible in main().
+**********************************************************************/
+void StackMonitor_Init(void);
+
+/*********************************************************************
+* Service Name: StackMonitor_Register
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Name_Ptr - stack name / Bottom_Ptr - lowest address / Size_Bytes - stack size
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StackMonitor_IdType - ID of the stack or STACKMONITOR_INVALID_ID
+* Description: Function to monitor a stack that is not in use yet, e.g. a
+  task stack. The whole stack is painted.
+**********************************************************************/
+StackMonitor_IdType StackMonitor_Register(const char *Name_Ptr, uint32 *Bottom_Ptr, uint32 Size_Bytes);
+
+/*********************************************************************
+* Service Name: StackMonitor_SetLowerLimit
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Stack_Id - ID of the stack / Limit_Ptr - lowest address the monitor may read
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to keep the scanner away from the bottom of a stack,
+  e.g. when an MPU guard region was placed there.
+**********************************************************************/
+void StackMonitor_SetLowerLimit(StackMonitor_IdType Stack_Id, uint32 *Limit_Ptr);
+
+/*********************************************************************
+* Service Name: StackMonitor_Poll
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to check the next STACKMONITOR_SCAN_CHUNK_WORDS words
+  of every stack, to be called from the idle loop.
+**********************************************************************/
+void StackMonitor_Poll(void);
+
+/*********************************************************************
+* Service Name: StackMonitor_GetReport
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Stack_Id - ID of the stack
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - size and usage of the stack
+* Return value: boolean - FALSE if the ID is wrong
+* Description: Function to read the high-water mark of a stack.
+**********************************************************************/
+boolean StackMonitor_GetReport(StackMonitor_IdType Stack_Id, StackMonitor_ReportType *Report_Ptr);
+
+#endif /* STACKMONITOR_H_ */
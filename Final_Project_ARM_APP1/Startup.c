@@ -0,0 +1,173 @@
+ /******************************************************************************
+ *
+ * Module: Startup
+ *
+ * File Name: Startup.c
+ *
+ * Description: Source file for the lean startup
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Startup.h"
+#include "FPU.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Cycle counter at the end of each phase, written once .bss is zeroed */
+static uint32 g_Startup_PhaseCycles[STARTUP_PHASES_NUM];
+
+#if (STARTUP_LEAN == TRUE)
+
+/* Placement of .data and .bss, defined by the linker command file */
+extern uint32 __data_load_start;
+extern uint32 __data_run_start;
+extern uint32 __data_size;
+extern uint32 __bss_start;
+extern uint32 __bss_end;
+extern uint32 __ramfunc_load_start;
+extern uint32 __ramfunc_run_start;
+extern uint32 __ramfunc_size;
+
+extern int main(void);
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Copy a_Words words, four at a time with LDM/STM then one at a time */
+void Startup_CopyWords(uint32 *a_Dest_Ptr, const uint32 *a_Src_Ptr, uint32 a_Words);
+
+__asm("    .sect \".text:Startup_CopyWords\"\n"
+      "    .clink\n"
+      "    .thumbfunc Startup_CopyWords\n"
+      "    .thumb\n"
+      "    .global Startup_CopyWords\n"
+      "Startup_CopyWords:\n"
+      "    push    {r4-r6}\n"
+      "    subs    r2, r2, #4\n"
+      "    blo     Startup_CopyWords_Tail\n"
+      "Startup_CopyWords_Block:\n"
+      "    ldmia   r1!, {r3-r6}\n"
+      "    stmia   r0!, {r3-r6}\n"
+      "    subs    r2, r2, #4\n"
+      "    bhs     Startup_CopyWords_Block\n"
+      "Startup_CopyWords_Tail:\n"
+      "    adds    r2, r2, #4\n"
+      "    beq     Startup_CopyWords_Done\n"
+      "Startup_CopyWords_Word:\n"
+      "    ldr     r3, [r1], #4\n"
+      "    str     r3, [r0], #4\n"
+      "    subs    r2, r2, #1\n"
+      "    bne     Startup_CopyWords_Word\n"
+      "Startup_CopyWords_Done:\n"
+      "    pop     {r4-r6}\n"
+      "    bx      lr\n");
+
+/* Zero a_Words words, four at a time with STM then one at a time */
+void Startup_ZeroWords(uint32 *a_Dest_Ptr, uint32 a_Words);
+
+__asm("    .sect \".text:Startup_ZeroWords\"\n"
+      "    .clink\n"
+      "    .thumbfunc Startup_ZeroWords\n"
+      "    .thumb\n"
+      "    .global Startup_ZeroWords\n"
+      "Startup_ZeroWords:\n"
+      "    push    {r4}\n"
+      "    movs    r2, #0\n"
+      "    movs    r3, #0\n"
+      "    movs    r4, #0\n"
+      "    mov     r12, #0\n"
+      "    subs    r1, r1, #4\n"
+      "    blo     Startup_ZeroWords_Tail\n"
+      "Startup_ZeroWords_Block:\n"
+      "    stmia   r0!, {r2-r4, r12}\n"
+      "    subs    r1, r1, #4\n"
+      "    bhs     Startup_ZeroWords_Block\n"
+      "Startup_ZeroWords_Tail:\n"
+      "    adds    r1, r1, #4\n"
+      "    beq     Startup_ZeroWords_Done\n"
+      "Startup_ZeroWords_Word:\n"
+      "    str     r2, [r0], #4\n"
+      "    subs    r1, r1, #1\n"
+      "    bne     Startup_ZeroWords_Word\n"
+      "Startup_ZeroWords_Done:\n"
+      "    pop     {r4}\n"
+      "    bx      lr\n");
+
+#endif
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+#if (STARTUP_LEAN == TRUE)
+/*********************************************************************
+* Service Name: Startup_Lean
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Entry of the lean startup, branched to from ResetISR(). It never
+  returns.
+**********************************************************************/
+CODE_COLD void Startup_Lean(void)
+{
+    uint32 fpu_cycles;
+    uint32 data_cycles;
+    uint32 bss_cycles;
+
+    /* The cycle counter was started from 0 by ResetISR() */
+
+    /* FPU on before any compiled code may use it, the context is stacked lazily:
+     * the S registers are saved only if the interrupt handler uses the FPU too */
+    FPU_Init();
+    fpu_cycles = DWT_CYCCNT_REG;
+
+    Startup_CopyWords(&__data_run_start, &__data_load_start, (uint32)&__data_size / sizeof(uint32));
+    Startup_CopyWords(&__ramfunc_run_start, &__ramfunc_load_start, (uint32)&__ramfunc_size / sizeof(uint32));
+    data_cycles = DWT_CYCCNT_REG;
+
+    Startup_ZeroWords(&__bss_start, (uint32)(&__bss_end - &__bss_start));
+    bss_cycles = DWT_CYCCNT_REG;
+
+    g_Startup_PhaseCycles[STARTUP_PHASE_FPU_ENABLED] = fpu_cycles;
+    g_Startup_PhaseCycles[STARTUP_PHASE_DATA_COPIED] = data_cycles;
+    g_Startup_PhaseCycles[STARTUP_PHASE_BSS_ZEROED] = bss_cycles;
+    g_Startup_PhaseCycles[STARTUP_PHASE_MAIN_CALLED] = DWT_CYCCNT_REG;
+
+    (void)main();
+
+    while (1)
+    {
+        /*main() is not expected to return*/
+    }
+}
+#endif
+
+/*********************************************************************
+* Service Name: Startup_GetPhaseCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Phase - startup phase
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - cycles from the reset handler to the end of the phase
+* Description: Function to read the boot timestamps, all of them are 0 when the
+  TI run-time startup was used.
+**********************************************************************/
+uint32 Startup_GetPhaseCycles(Startup_PhaseType Phase)
+{
+    if (Phase >= STARTUP_PHASES_NUM)
+    {
+        return 0;
+    }
+    return g_Startup_PhaseCycles[Phase];
+}
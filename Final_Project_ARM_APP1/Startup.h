@@ -0,0 +1,77 @@
+ /******************************************************************************
+ *
+ * Module: Startup
+ *
+ * File Name: Startup.h
+ *
+ * Description: Header file for the lean startup. With STARTUP_LEAN the reset
+ *              handler runs Startup_Lean() instead of the TI run-time _c_int00:
+ *              it enables the FPU, copies .data and the SRAM code and zeroes .bss
+ *              with word block loops and calls main(), timestamping every phase
+ *
+ *******************************************************************************/
+
+#ifndef STARTUP_H_
+#define STARTUP_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Define STARTUP_LEAN=1 for the compiler and the linker to use Startup_Lean(), the
+ * linker command file then places .data and .bss for it. The C++ constructors and
+ * the exit handling of _c_int00 are not supported on that path. */
+#ifndef STARTUP_LEAN
+#define STARTUP_LEAN                         FALSE
+#endif
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* End of each startup phase, in order */
+typedef enum
+{
+    STARTUP_PHASE_FPU_ENABLED,
+    STARTUP_PHASE_DATA_COPIED,
+    STARTUP_PHASE_BSS_ZEROED,
+    STARTUP_PHASE_MAIN_CALLED,
+    STARTUP_PHASES_NUM
+}Startup_PhaseType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Startup_Lean
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Entry of the lean startup, branched to from ResetISR(). It never
+  returns.
+**********************************************************************/
+void Startup_Lean(void);
+
+/*********************************************************************
+* Service Name: Startup_GetPhaseCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Phase - startup phase
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - cycles from the reset handler to the end of the phase
+* Description: Function to read the boot timestamps, all of them are 0 when the
+  TI run-time startup was used.
+**********************************************************************/
+uint32 Startup_GetPhaseCycles(Startup_PhaseType Phase);
+
+#endif /* STARTUP_H_ */
@@ -11,17 +11,26 @@
 #include"SysTick.h"
 #include "tm4c123gh6pm_registers.h"
 #include "common_macros.h"
+#include "Profiler.h"
+#include "IrqLatency.h"
+#include "PcSampler.h"
+#include "Trace.h"
+#include "FPU.h"
+#include "Log.h"
+#include "RamFunc.h"
+#include "CodeLayout.h"
 
 /*******************************************************************************
  *                             PreProcessor Macros                             *
  *******************************************************************************/
-#define SYS_FREQ                            16000000
 #define SYSTICK_COUNT_FLAG_BIT_MASK         0x00010000
 #define SYSTICK_CLEAR_CTRL_BITS_MASK        0xFFFFFFF8
 #define SYSTICK_ENABLE_WITH_SYSTEM_CLK      0x05
 #define SYSTICK_ENABLE_WITH_INT_SYSTEM_CLK  0x07
 #define SYSTICK_INITIAL_VALUE               0
 #define SYSTICK_ENABLE_DISABLE_BIT_POS      0
+#define SYSTICK_MAX_RELOAD_VALUE            0x00FFFFFF
+#define SYSTICK_MAX_TIME_IN_MS              ((SYSTICK_MAX_RELOAD_VALUE + 1) / (SYS_FREQ / 1000))
 /*******************************************************************************
  *                          Private Global Variables                           *
  *******************************************************************************/
@@ -43,8 +52,16 @@ static volatile void (*callbackFcn_ptr) (void);
  *  Description: Initialize the SysTick timer to generate intterrupt every specified
     time in milliseconds
  **********************************************************************/
-void SysTick_Init(uint16 a_TimeInMilliSeconds)
+CODE_COLD void SysTick_Init(uint16 a_TimeInMilliSeconds)
 {
+    /* The 24-bit reload value limits the period to SYSTICK_MAX_TIME_IN_MS */
+    if (a_TimeInMilliSeconds == 0 || a_TimeInMilliSeconds > SYSTICK_MAX_TIME_IN_MS)
+    {
+        /*WRONG TIME DO NOTHING*/
+        LOG_1(LOG_LEVEL_ERROR, "SysTick_Init: invalid period %u ms", a_TimeInMilliSeconds);
+        return;
+    }
+
     /*  1. Program reload value.
         2. Clear current value.
         3. Program Control and Status register */
@@ -56,6 +73,8 @@ void SysTick_Init(uint16 a_TimeInMilliSeconds)
      * Enable SysTick Interrupt (INTEN = 1)
      * Choose the clock source to be System Clock (CLK_SRC = 1) */
     SYSTICK_CTRL_REG |= SYSTICK_ENABLE_WITH_INT_SYSTEM_CLK;
+
+    LOG_2(LOG_LEVEL_INFO, "SysTick_Init: period %u ms, reload %u", a_TimeInMilliSeconds, SYSTICK_RELOAD_REG);
 }
 
 /*********************************************************************
@@ -71,6 +90,14 @@ void SysTick_Init(uint16 a_TimeInMilliSeconds)
  **********************************************************************/
 void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds)
 {
+    /* The 24-bit reload value limits the period to SYSTICK_MAX_TIME_IN_MS */
+    if (a_TimeInMilliSeconds == 0 || a_TimeInMilliSeconds > SYSTICK_MAX_TIME_IN_MS)
+    {
+        /*WRONG TIME DO NOTHING*/
+        LOG_1(LOG_LEVEL_ERROR, "SysTick_StartBusyWait: invalid period %u ms", a_TimeInMilliSeconds);
+        return;
+    }
+
     /*  1. Program reload value.
         2. Clear current value.
         3. Program Control and Status register */
@@ -99,11 +126,51 @@ void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds)
  *  Parameters (inout): None
  *  Parameters (out): None
  *  Return value: None
- *  Description: Handler for SysTick interrupt use to call the call-back function
+ *  Description: Handler for SysTick interrupt use to call the call-back function.
+    With PCSAMPLER_ENABLE it is entered through an assembly stub and also
+    samples the interrupted PC.
  **********************************************************************/
-void SysTick_Handler(void)
+#if (PCSAMPLER_ENABLE == TRUE)
+void SysTick_FrameHandler(const uint32 *a_Frame_Ptr);
+
+/* Exception entry: pass the stack frame of the interrupted code to SysTick_FrameHandler.
+ * Bit 2 of EXC_RETURN tells whether it was stacked on the MSP or on the PSP, and LR
+ * still holds EXC_RETURN when SysTick_FrameHandler returns. The stub stays in flash
+ * and SysTick_FrameHandler may run from SRAM, out of the B.W range, so it jumps
+ * through a register (the linker sets the Thumb bit of the address) */
+__asm("    .sect \".text:SysTick_Handler\"\n"
+      "    .clink\n"
+      "    .thumbfunc SysTick_Handler\n"
+      "    .thumb\n"
+      "    .global SysTick_Handler\n"
+      "    .global SysTick_FrameHandler\n"
+      "SysTick_Handler:\n"
+      "    tst     lr, #4\n"
+      "    ite     eq\n"
+      "    mrseq   r0, msp\n"
+      "    mrsne   r0, psp\n"
+      "    movw    r1, SysTick_FrameHandler\n"
+      "    movt    r1, SysTick_FrameHandler\n"
+      "    bx      r1\n");
+
+RAMFUNC void SysTick_FrameHandler(const uint32 *a_Frame_Ptr)
+#else
+RAMFUNC void SysTick_Handler(void)
+#endif
 {
+    IRQLATENCY_SYSTICK_ENTRY();
+    TRACE_ISR_ENTER(TRACE_EXCEPTION_SYSTICK);
+    FPU_NOFPU_ISR_ENTER();
+    PROFILER_BEGIN(PROFILER_PROBE_SYSTICK_HANDLER);
+#if (PCSAMPLER_ENABLE == TRUE)
+    PcSampler_Sample(a_Frame_Ptr[PCSAMPLER_FRAME_PC_INDEX]);
+#endif
+    TRACE_CALLBACK_ENTER(TRACE_EXCEPTION_SYSTICK);
     (*callbackFcn_ptr)();
+    TRACE_CALLBACK_EXIT(TRACE_EXCEPTION_SYSTICK);
+    PROFILER_END(PROFILER_PROBE_SYSTICK_HANDLER);
+    FPU_NOFPU_ISR_EXIT(TRACE_EXCEPTION_SYSTICK);
+    TRACE_ISR_EXIT(TRACE_EXCEPTION_SYSTICK);
 }
 
 /*********************************************************************
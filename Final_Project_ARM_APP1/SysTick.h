@@ -16,7 +16,10 @@
 /*******************************************************************************
  *                             PreProcessor Macros                             *
  *******************************************************************************/
-
+/* System clock, SysTick counts it and the UART and trace timestamps use it too */
+#ifndef SYS_FREQ
+#define SYS_FREQ                            16000000
+#endif
 
 /*******************************************************************************
  *                         User Defined Data Types                             *
@@ -0,0 +1,345 @@
+ /******************************************************************************
+ *
+ * Module: Telemetry
+ *
+ * File Name: Telemetry.c
+ *
+ * Description: Source file for the binary telemetry frames
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Telemetry.h"
+#include "UART.h"
+#include "Crc.h"
+#include "interruptsControl.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define TELEMETRY_UART_BUFFERS_MASK          ((1u << TELEMETRY_UART_BUFFERS_NUM) - 1u)
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+static Telemetry_SinkType g_Telemetry_Sink = TELEMETRY_SINK_MEMORY;
+static uint8 g_Telemetry_Sequence = 0;
+
+/* UART0 sink: a set bit is a free buffer */
+static uint8 g_Telemetry_UartBuffers[TELEMETRY_UART_BUFFERS_NUM][TELEMETRY_FRAME_MAX_SIZE];
+static uint32 g_Telemetry_UartFree = TELEMETRY_UART_BUFFERS_MASK;
+
+static Telemetry_StatsType g_Telemetry_Stats;
+
+/* Memory sink and the offset of its next frame, found by tools/telemetry.py in
+ * the symbol table. A frame that does not fit before the end of the ring starts
+ * at offset 0, the end is filled with delimiters */
+static uint8 g_Telemetry_Memory[TELEMETRY_MEMORY_SIZE];
+static volatile uint32 g_Telemetry_MemoryHead = 0;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Called with the interrupts disabled */
+static uint8 *Telemetry_UartClaim(void)
+{
+    uint32 index;
+
+    for (index = 0; index < TELEMETRY_UART_BUFFERS_NUM; index++)
+    {
+        if (g_Telemetry_UartFree & (1u << index))
+        {
+            g_Telemetry_UartFree &= ~(1u << index);
+            return g_Telemetry_UartBuffers[index];
+        }
+    }
+    return NULL_PTR;
+}
+
+/* UART TX queue callback, in the UART0 ISR once the frame is sent */
+static void Telemetry_UartRelease(const uint8 *Data_Ptr)
+{
+    uint32 index = (uint32)(Data_Ptr - &g_Telemetry_UartBuffers[0][0]) / TELEMETRY_FRAME_MAX_SIZE;
+    uint32 primask;
+
+    primask = Interrupts_DisableSave();
+    g_Telemetry_UartFree |= (1u << index);
+    Interrupts_Restore(primask);
+}
+
+/* Called with the interrupts disabled */
+static uint8 *Telemetry_MemoryClaim(uint16 Size)
+{
+    uint32 head = g_Telemetry_MemoryHead;
+    uint8 *frame_ptr;
+
+    if (head + Size > TELEMETRY_MEMORY_SIZE)
+    {
+        while (head < TELEMETRY_MEMORY_SIZE)
+        {
+            g_Telemetry_Memory[head++] = 0;
+        }
+        head = 0;
+    }
+    frame_ptr = &g_Telemetry_Memory[head];
+    g_Telemetry_MemoryHead = (head + Size) % TELEMETRY_MEMORY_SIZE;
+    return frame_ptr;
+}
+
+/* COBS: every zero becomes the code byte of its block, the distance to the next
+ * zero. Frames stay below 254 bytes, so no block needs the 0xFF code */
+static void Telemetry_EncodeBytes(Telemetry_FrameType *Frame_Ptr, const uint8 *Data_Ptr, uint16 Size)
+{
+    uint8 *buffer_ptr = Frame_Ptr->Buffer_Ptr;
+    uint16 position = Frame_Ptr->Position;
+    uint16 code_position = Frame_Ptr->Code_Position;
+    uint16 i;
+
+    for (i = 0; i < Size; i++)
+    {
+        if (Data_Ptr[i] == 0)
+        {
+            buffer_ptr[code_position] = (uint8)(position - code_position);
+            code_position = position;
+        }
+        else
+        {
+            buffer_ptr[position] = Data_Ptr[i];
+        }
+        position++;
+    }
+    Frame_Ptr->Position = position;
+    Frame_Ptr->Code_Position = code_position;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Telemetry_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Config_Ptr - sink of the frames
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the sink and reset the buffers, the sequence
+  number and the counters. No frame may be in flight.
+**********************************************************************/
+CODE_COLD void Telemetry_Init(const Telemetry_ConfigType *Config_Ptr)
+{
+    uint32 index;
+
+    if (Config_Ptr == NULL_PTR)
+    {
+        /*WRONG CONFIGURATION POINTER DO NOTHING*/
+        return;
+    }
+
+    g_Telemetry_Sink = Config_Ptr->Sink;
+    g_Telemetry_Sequence = 0;
+    g_Telemetry_UartFree = TELEMETRY_UART_BUFFERS_MASK;
+    for (index = 0; index < TELEMETRY_MEMORY_SIZE; index++)
+    {
+        g_Telemetry_Memory[index] = 0;
+    }
+    g_Telemetry_MemoryHead = 0;
+    g_Telemetry_Stats.Frames = 0;
+    g_Telemetry_Stats.Bytes = 0;
+    g_Telemetry_Stats.Dropped = 0;
+}
+
+/*********************************************************************
+* Service Name: Telemetry_Begin
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Type - record type / Size - payload bytes (0 - TELEMETRY_MAX_PAYLOAD)
+* Parameters (inout): None
+* Parameters (out): Frame_Ptr - frame to write
+* Return value: boolean - FALSE if the sink has no room, the frame is dropped
+* Description: Function to take a buffer from the sink and write the record
+  header. The frame must be written with Telemetry_Put() and ended with
+  Telemetry_End() in the same context. Can be called from any ISR.
+**********************************************************************/
+CODE_HOT boolean Telemetry_Begin(Telemetry_FrameType *Frame_Ptr, Telemetry_RecordType Type, uint16 Size)
+{
+    uint8 header[TELEMETRY_HEADER_SIZE];
+    uint32 timestamp = DWT_CYCCNT_REG;
+    uint32 primask;
+
+    if (Frame_Ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+    Frame_Ptr->Buffer_Ptr = NULL_PTR;
+    if (Size > TELEMETRY_MAX_PAYLOAD)
+    {
+        return FALSE;
+    }
+
+    primask = Interrupts_DisableSave();
+    if (g_Telemetry_Sink == TELEMETRY_SINK_UART0)
+    {
+        Frame_Ptr->Buffer_Ptr = Telemetry_UartClaim();
+    }
+    else
+    {
+        Frame_Ptr->Buffer_Ptr = Telemetry_MemoryClaim(TELEMETRY_FRAME_SIZE(Size));
+    }
+    if (Frame_Ptr->Buffer_Ptr == NULL_PTR)
+    {
+        g_Telemetry_Stats.Dropped++;
+        Interrupts_Restore(primask);
+        return FALSE;
+    }
+    header[1] = g_Telemetry_Sequence++;
+    Interrupts_Restore(primask);
+
+    header[0] = (uint8)Type;
+    header[2] = (uint8)timestamp;
+    header[3] = (uint8)(timestamp >> 8);
+    header[4] = (uint8)(timestamp >> 16);
+    header[5] = (uint8)(timestamp >> 24);
+
+    /* The first code byte is written at the end of its block */
+    Frame_Ptr->Code_Position = 0;
+    Frame_Ptr->Position = 1;
+    Frame_Ptr->Remaining = Size;
+    Frame_Ptr->Crc = Crc_Crc16(header, TELEMETRY_HEADER_SIZE, CRC16_INITIAL_VALUE);
+    Telemetry_EncodeBytes(Frame_Ptr, header, TELEMETRY_HEADER_SIZE);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: Telemetry_Put
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Data_Ptr - payload bytes / Size - number of bytes
+* Parameters (inout): Frame_Ptr - frame from Telemetry_Begin()
+* Parameters (out): None
+* Return value: None
+* Description: Function to encode the next payload bytes into the buffer of the
+  sink. The bytes over the size given to Telemetry_Begin() are ignored.
+**********************************************************************/
+CODE_HOT void Telemetry_Put(Telemetry_FrameType *Frame_Ptr, const void *Data_Ptr, uint16 Size)
+{
+    if (Frame_Ptr == NULL_PTR || Frame_Ptr->Buffer_Ptr == NULL_PTR || Data_Ptr == NULL_PTR)
+    {
+        return;
+    }
+
+    if (Size > Frame_Ptr->Remaining)
+    {
+        Size = Frame_Ptr->Remaining;
+    }
+    Frame_Ptr->Remaining -= Size;
+    Frame_Ptr->Crc = Crc_Crc16((const uint8 *)Data_Ptr, Size, Frame_Ptr->Crc);
+    Telemetry_EncodeBytes(Frame_Ptr, (const uint8 *)Data_Ptr, Size);
+}
+
+/*********************************************************************
+* Service Name: Telemetry_End
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): Frame_Ptr - frame from Telemetry_Begin()
+* Parameters (out): None
+* Return value: boolean - FALSE if the UART TX queue was full, the frame is dropped
+* Description: Function to append the CRC and the delimiter and hand the frame
+  to the sink. The payload bytes not written are sent as zeros.
+**********************************************************************/
+CODE_HOT boolean Telemetry_End(Telemetry_FrameType *Frame_Ptr)
+{
+    static const uint8 zero = 0;
+    uint8 crc[TELEMETRY_CRC_SIZE];
+    uint8 *buffer_ptr;
+    uint16 length;
+    uint32 primask;
+
+    if (Frame_Ptr == NULL_PTR || Frame_Ptr->Buffer_Ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    while (Frame_Ptr->Remaining > 0)
+    {
+        Telemetry_Put(Frame_Ptr, &zero, 1);
+    }
+    crc[0] = (uint8)Frame_Ptr->Crc;
+    crc[1] = (uint8)(Frame_Ptr->Crc >> 8);
+    Telemetry_EncodeBytes(Frame_Ptr, crc, TELEMETRY_CRC_SIZE);
+
+    /* Close the last block and delimit the frame */
+    buffer_ptr = Frame_Ptr->Buffer_Ptr;
+    buffer_ptr[Frame_Ptr->Code_Position] = (uint8)(Frame_Ptr->Position - Frame_Ptr->Code_Position);
+    buffer_ptr[Frame_Ptr->Position] = 0;
+    length = Frame_Ptr->Position + 1;
+    Frame_Ptr->Buffer_Ptr = NULL_PTR;
+
+    if (g_Telemetry_Sink == TELEMETRY_SINK_UART0 && !UART_QueueTx(buffer_ptr, length, Telemetry_UartRelease))
+    {
+        Telemetry_UartRelease(buffer_ptr);
+        primask = Interrupts_DisableSave();
+        g_Telemetry_Stats.Dropped++;
+        Interrupts_Restore(primask);
+        return FALSE;
+    }
+
+    primask = Interrupts_DisableSave();
+    g_Telemetry_Stats.Frames++;
+    g_Telemetry_Stats.Bytes += length;
+    Interrupts_Restore(primask);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: Telemetry_Send
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): Type - record type / Data_Ptr - payload / Size - payload bytes (0 - TELEMETRY_MAX_PAYLOAD)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the frame was dropped
+* Description: Function to send a record held in one block.
+**********************************************************************/
+CODE_HOT boolean Telemetry_Send(Telemetry_RecordType Type, const void *Data_Ptr, uint16 Size)
+{
+    Telemetry_FrameType frame;
+
+    if (!Telemetry_Begin(&frame, Type, Size))
+    {
+        return FALSE;
+    }
+    Telemetry_Put(&frame, Data_Ptr, Size);
+    return Telemetry_End(&frame);
+}
+
+/*********************************************************************
+* Service Name: Telemetry_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Stats_Ptr - frame counters
+* Return value: None
+* Description: Function to read the frame, byte and drop counters.
+**********************************************************************/
+void Telemetry_GetStats(Telemetry_StatsType *Stats_Ptr)
+{
+    uint32 primask;
+
+    if (Stats_Ptr == NULL_PTR)
+    {
+        return;
+    }
+
+    primask = Interrupts_DisableSave();
+    *Stats_Ptr = g_Telemetry_Stats;
+    Interrupts_Restore(primask);
+}
@@ -0,0 +1,171 @@
+ /******************************************************************************
+ *
+ * Module: Telemetry
+ *
+ * File Name: Telemetry.h
+ *
+ * Description: Header file for the binary telemetry frames. A frame is a
+ *              typed record header, the payload and a CRC-16, COBS encoded and
+ *              ended by a 0x00 delimiter. The record is encoded straight into
+ *              the buffer of the sink while it is written, there is no second
+ *              copy. tools/telemetry.py decodes the frames on the host
+ *
+ *******************************************************************************/
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to TRUE to send records from the SysTick callback and the PORTF ISR */
+#ifndef TELEMETRY_ISR_RECORDS
+#define TELEMETRY_ISR_RECORDS                FALSE
+#endif
+
+/* Record header: type (uint8), sequence (uint8) and the cycle counter (uint32) */
+#define TELEMETRY_HEADER_SIZE                6u
+#define TELEMETRY_CRC_SIZE                   2u
+
+/* Header, payload and CRC stay below 254 bytes, so the COBS encoding is one code
+ * byte longer and a frame fits 256 bytes with its delimiter */
+#define TELEMETRY_MAX_PAYLOAD                245u
+#define TELEMETRY_FRAME_SIZE(PAYLOAD)        ((PAYLOAD) + TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE + 2u)
+#define TELEMETRY_FRAME_MAX_SIZE             256u
+
+/* UART0 sink: frames in flight on the UART TX queue */
+#define TELEMETRY_UART_BUFFERS_NUM           8u
+
+/* Memory sink: ring of frames in SRAM, read it with the debugger */
+#define TELEMETRY_MEMORY_SIZE                2048u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef enum
+{
+    TELEMETRY_SINK_UART0,     /* UART_QueueTx(), needs UART_Init() */
+    TELEMETRY_SINK_MEMORY     /* g_Telemetry_Memory, the oldest frames are overwritten */
+}Telemetry_SinkType;
+
+/* Payload layouts, little endian, known by tools/telemetry.py */
+typedef enum
+{
+    TELEMETRY_RECORD_COUNTERS = 1,   /* uint32 counters */
+    TELEMETRY_RECORD_PROFILE = 2,    /* uint8 probe ID then count, min, max and mean cycles (uint32) */
+    TELEMETRY_RECORD_EVENT = 3,      /* uint32 event ID and uint32 value */
+    TELEMETRY_RECORD_TEXT = 4,       /* ASCII characters */
+    TELEMETRY_RECORD_USER = 0x80     /* first application defined type */
+}Telemetry_RecordType;
+
+typedef struct
+{
+    Telemetry_SinkType Sink;
+}Telemetry_ConfigType;
+
+/* Frame being written, only used through the functions below */
+typedef struct
+{
+    uint8 *Buffer_Ptr;       /* NULL_PTR if the frame was not started */
+    uint16 Position;         /* next encoded byte */
+    uint16 Code_Position;    /* COBS code byte of the current block */
+    uint16 Remaining;        /* payload bytes not written yet */
+    uint16 Crc;
+}Telemetry_FrameType;
+
+typedef struct
+{
+    uint32 Frames;
+    uint32 Bytes;            /* encoded bytes with the delimiters */
+    uint32 Dropped;          /* frames without a free buffer or lost by the UART TX queue */
+}Telemetry_StatsType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Telemetry_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Config_Ptr - sink of the frames
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the sink and reset the buffers, the sequence
+  number and the counters. No frame may be in flight.
+**********************************************************************/
+void Telemetry_Init(const Telemetry_ConfigType *Config_Ptr);
+
+/*********************************************************************
+* Service Name: Telemetry_Begin
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Type - record type / Size - payload bytes (0 - TELEMETRY_MAX_PAYLOAD)
+* Parameters (inout): None
+* Parameters (out): Frame_Ptr - frame to write
+* Return value: boolean - FALSE if the sink has no room, the frame is dropped
+* Description: Function to take a buffer from the sink and write the record
+  header. The frame must be written with Telemetry_Put() and ended with
+  Telemetry_End() in the same context. Can be called from any ISR.
+**********************************************************************/
+boolean Telemetry_Begin(Telemetry_FrameType *Frame_Ptr, Telemetry_RecordType Type, uint16 Size);
+
+/*********************************************************************
+* Service Name: Telemetry_Put
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Data_Ptr - payload bytes / Size - number of bytes
+* Parameters (inout): Frame_Ptr - frame from Telemetry_Begin()
+* Parameters (out): None
+* Return value: None
+* Description: Function to encode the next payload bytes into the buffer of the
+  sink. The bytes over the size given to Telemetry_Begin() are ignored.
+**********************************************************************/
+void Telemetry_Put(Telemetry_FrameType *Frame_Ptr, const void *Data_Ptr, uint16 Size);
+
+/*********************************************************************
+* Service Name: Telemetry_End
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): Frame_Ptr - frame from Telemetry_Begin()
+* Parameters (out): None
+* Return value: boolean - FALSE if the UART TX queue was full, the frame is dropped
+* Description: Function to append the CRC and the delimiter and hand the frame
+  to the sink. The payload bytes not written are sent as zeros.
+**********************************************************************/
+boolean Telemetry_End(Telemetry_FrameType *Frame_Ptr);
+
+/*********************************************************************
+* Service Name: Telemetry_Send
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): Type - record type / Data_Ptr - payload / Size - payload bytes (0 - TELEMETRY_MAX_PAYLOAD)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the frame was dropped
+* Description: Function to send a record held in one block.
+**********************************************************************/
+boolean Telemetry_Send(Telemetry_RecordType Type, const void *Data_Ptr, uint16 Size);
+
+/*********************************************************************
+* Service Name: Telemetry_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Stats_Ptr - frame counters
+* Return value: None
+* Description: Function to read the frame, byte and drop counters.
+**********************************************************************/
+void Telemetry_GetStats(Telemetry_StatsType *Stats_Ptr);
+
+#endif /* TELEMETRY_H_ */
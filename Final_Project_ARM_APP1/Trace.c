@@ -0,0 +1,235 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.c
+ *
+ * Description: Source file for the binary event trace recorder
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "Trace.h"
+#include "interruptsControl.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define TRACE_INDEX_MASK                     (TRACE_BUFFER_SIZE - 1u)
+#define TRACE_VARINT_DATA_MASK               0x7Fu
+#define TRACE_VARINT_MORE_MASK               0x80u
+#define TRACE_VARINT_DATA_BITS               7u
+
+#if ((TRACE_BUFFER_SIZE & TRACE_INDEX_MASK) != 0)
+#error "TRACE_BUFFER_SIZE must be a power of two"
+#endif
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* The control block, left public in the map file so it can be dumped by name */
+Trace_ControlBlockType g_Trace;
+
+static volatile boolean g_Trace_Enabled = FALSE;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Append the LEB128 encoding of Value at Record_Ptr[Length], return the new length */
+static uint32 Trace_PutVarint(uint8 *Record_Ptr, uint32 Length, uint32 Value)
+{
+    while (Value > TRACE_VARINT_DATA_MASK)
+    {
+        Record_Ptr[Length++] = (uint8)(Value | TRACE_VARINT_MORE_MASK);
+        Value >>= TRACE_VARINT_DATA_BITS;
+    }
+    Record_Ptr[Length++] = (uint8)Value;
+    return Length;
+}
+
+/* Decode the varint at ring offset *Index_Ptr and advance the offset past it */
+static uint32 Trace_GetVarint(uint32 *Index_Ptr)
+{
+    uint32 value = 0;
+    uint8 shift = 0;
+    uint8 byte;
+
+    do
+    {
+        byte = g_Trace.Buffer[(*Index_Ptr)++ & TRACE_INDEX_MASK];
+        value |= (uint32)(byte & TRACE_VARINT_DATA_MASK) << shift;
+        shift += TRACE_VARINT_DATA_BITS;
+    } while (byte & TRACE_VARINT_MORE_MASK);
+
+    return value;
+}
+
+/* Drop the oldest record, keeping the dump decodable: the next record is
+ * relative to the dropped one. Called with the interrupts disabled */
+static void Trace_DropOldest(void)
+{
+    uint32 read_index = g_Trace.Read_Index + 1;
+
+    g_Trace.Read_Timestamp += Trace_GetVarint(&read_index);
+    (void)Trace_GetVarint(&read_index);
+    g_Trace.Read_Index = read_index;
+    g_Trace.Dropped++;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Trace_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to empty the trace buffer and start recording. The
+  timestamps come from the DWT cycle counter started by Profiler_Init().
+**********************************************************************/
+CODE_COLD void Trace_Init(void)
+{
+    uint32 primask = Interrupts_DisableSave();
+
+    g_Trace.Magic = TRACE_MAGIC;
+    g_Trace.Size = TRACE_BUFFER_SIZE;
+    g_Trace.Cpu_Frequency = TRACE_CPU_FREQUENCY_HZ;
+    g_Trace.Write_Index = 0;
+    g_Trace.Read_Index = 0;
+    g_Trace.Last_Timestamp = DWT_CYCCNT_REG;
+    g_Trace.Read_Timestamp = g_Trace.Last_Timestamp;
+    g_Trace.Dropped = 0;
+    g_Trace_Enabled = TRUE;
+
+    Interrupts_Restore(primask);
+}
+
+/*********************************************************************
+* Service Name: Trace_Record
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Event - type of the record / Arg - event argument
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to append one record. When the buffer is full the oldest
+  whole records are overwritten, or with TRACE_OVERWRITE FALSE the new record is
+  dropped. Either way the lost records are counted.
+**********************************************************************/
+CODE_HOT void Trace_Record(Trace_EventType Event, uint32 Arg)
+{
+    uint8 record[TRACE_RECORD_MAX_SIZE];
+    uint32 length;
+    uint32 now;
+    uint32 write_index;
+    uint32 primask;
+    uint32 i;
+
+    if (!g_Trace_Enabled)
+    {
+        return;
+    }
+
+    /* The timestamp and the buffer update must not be split by a nested event,
+     * or the deltas would go out of order */
+    primask = Interrupts_DisableSave();
+
+    now = DWT_CYCCNT_REG;
+    record[0] = (uint8)Event;
+    length = Trace_PutVarint(record, 1, now - g_Trace.Last_Timestamp);
+    length = Trace_PutVarint(record, length, Arg);
+
+    write_index = g_Trace.Write_Index;
+#if (TRACE_OVERWRITE == TRUE)
+    while ((TRACE_BUFFER_SIZE - (write_index - g_Trace.Read_Index)) < length)
+    {
+        /*BUFFER FULL DROP THE OLDEST RECORD*/
+        Trace_DropOldest();
+    }
+#else
+    if ((TRACE_BUFFER_SIZE - (write_index - g_Trace.Read_Index)) < length)
+    {
+        /*BUFFER FULL DROP THE NEW RECORD*/
+        g_Trace.Dropped++;
+        Interrupts_Restore(primask);
+        return;
+    }
+#endif
+
+    for (i = 0; i < length; i++)
+    {
+        g_Trace.Buffer[(write_index + i) & TRACE_INDEX_MASK] = record[i];
+    }
+    g_Trace.Last_Timestamp = now;
+    g_Trace.Write_Index = write_index + length;
+
+    Interrupts_Restore(primask);
+}
+
+/*********************************************************************
+* Service Name: Trace_Read
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Size - size of the destination buffer
+* Parameters (inout): None
+* Parameters (out): Buffer_Ptr - copied records
+* Return value: uint32 - number of bytes copied, always whole records
+* Description: Function to move the oldest records out of the trace buffer to
+  free space for new ones. There must be a single reader. Each record is taken
+  with the interrupts disabled, Trace_Record() may overwrite it otherwise.
+**********************************************************************/
+uint32 Trace_Read(uint8 *Buffer_Ptr, uint32 Size)
+{
+    uint32 copied = 0;
+    uint32 read_index;
+    uint32 record_end;
+    uint32 delta;
+    uint32 primask;
+
+    if (Buffer_Ptr == NULL_PTR)
+    {
+        return 0;
+    }
+
+    while (TRUE)
+    {
+        primask = Interrupts_DisableSave();
+        read_index = g_Trace.Read_Index;
+        if (read_index == g_Trace.Write_Index)
+        {
+            Interrupts_Restore(primask);
+            break;
+        }
+
+        /*find the end of the record: type byte, delta and argument*/
+        record_end = read_index + 1;
+        delta = Trace_GetVarint(&record_end);
+        (void)Trace_GetVarint(&record_end);
+
+        if ((record_end - read_index) > (Size - copied))
+        {
+            Interrupts_Restore(primask);
+            break;
+        }
+        while (read_index != record_end)
+        {
+            Buffer_Ptr[copied++] = g_Trace.Buffer[read_index++ & TRACE_INDEX_MASK];
+        }
+
+        /* Keep the dump decodable: the next unread record is relative to this one */
+        g_Trace.Read_Timestamp += delta;
+        g_Trace.Read_Index = read_index;
+        Interrupts_Restore(primask);
+    }
+
+    return copied;
+}
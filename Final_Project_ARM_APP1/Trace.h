@@ -0,0 +1,153 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.h
+ *
+ * Description: Header file for the binary event trace recorder. Events are kept
+ *              in an SRAM ring buffer as one type byte followed by the cycle
+ *              counter delta since the previous event and the event argument,
+ *              both varint encoded. tools/trace2perfetto.py converts a memory
+ *              dump of the control block to Chrome/Perfetto trace JSON
+ *
+ *******************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "SysTick.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Set to FALSE to compile every TRACE_xxx hook out of the build */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE                         TRUE
+#endif
+
+/* Set to FALSE to keep the oldest history: a full buffer then drops the new
+ * records until Trace_Read() frees space. By default the oldest records are
+ * overwritten, so a dump always holds the latest history */
+#ifndef TRACE_OVERWRITE
+#define TRACE_OVERWRITE                      TRUE
+#endif
+
+/* Ring buffer size in bytes, must be a power of two */
+#define TRACE_BUFFER_SIZE                    1024u
+
+/* Marks the control block in a memory dump, "TRCE" */
+#define TRACE_MAGIC                          0x45435254u
+
+/* Cycle counter frequency, written to the control block for the host tool */
+#define TRACE_CPU_FREQUENCY_HZ               ((uint32)SYS_FREQ)
+
+/* Longest record: type byte and two 5 bytes varints */
+#define TRACE_RECORD_MAX_SIZE                11u
+
+/* ISR IDs are the exception numbers of the vector table */
+#define TRACE_EXCEPTION_SYSTICK              15u
+#define TRACE_EXCEPTION_IRQ(IRQ_NUM)         ((IRQ_NUM) + 16u)
+
+#if (TRACE_ENABLE == TRUE)
+#define TRACE_ISR_ENTER(EXCEPTION_NUM)       Trace_Record(TRACE_EVENT_ISR_ENTER, (EXCEPTION_NUM))
+#define TRACE_ISR_EXIT(EXCEPTION_NUM)        Trace_Record(TRACE_EVENT_ISR_EXIT, (EXCEPTION_NUM))
+#define TRACE_TASK_SWITCH(TASK_ID)           Trace_Record(TRACE_EVENT_TASK_SWITCH, (TASK_ID))
+#define TRACE_CALLBACK_ENTER(EXCEPTION_NUM)  Trace_Record(TRACE_EVENT_CALLBACK_ENTER, (EXCEPTION_NUM))
+#define TRACE_CALLBACK_EXIT(EXCEPTION_NUM)   Trace_Record(TRACE_EVENT_CALLBACK_EXIT, (EXCEPTION_NUM))
+#define TRACE_MARKER(MARKER_ID)              Trace_Record(TRACE_EVENT_MARKER, (MARKER_ID))
+#define TRACE_IRQ_ENABLE(IRQ_NUM)            Trace_Record(TRACE_EVENT_IRQ_ENABLE, (IRQ_NUM))
+#define TRACE_IRQ_DISABLE(IRQ_NUM)           Trace_Record(TRACE_EVENT_IRQ_DISABLE, (IRQ_NUM))
+#else
+#define TRACE_ISR_ENTER(EXCEPTION_NUM)
+#define TRACE_ISR_EXIT(EXCEPTION_NUM)
+#define TRACE_TASK_SWITCH(TASK_ID)
+#define TRACE_CALLBACK_ENTER(EXCEPTION_NUM)
+#define TRACE_CALLBACK_EXIT(EXCEPTION_NUM)
+#define TRACE_MARKER(MARKER_ID)
+#define TRACE_IRQ_ENABLE(IRQ_NUM)
+#define TRACE_IRQ_DISABLE(IRQ_NUM)
+#endif
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* Record types, the values are part of the dump format read by the host tool */
+typedef enum
+{
+    TRACE_EVENT_ISR_ENTER = 1,
+    TRACE_EVENT_ISR_EXIT,
+    TRACE_EVENT_TASK_SWITCH,
+    TRACE_EVENT_CALLBACK_ENTER,
+    TRACE_EVENT_CALLBACK_EXIT,
+    TRACE_EVENT_MARKER,
+    TRACE_EVENT_IRQ_ENABLE,
+    TRACE_EVENT_IRQ_DISABLE
+}Trace_EventType;
+
+/* Control block layout, read by tools/trace2perfetto.py, keep both in sync.
+ * The indexes run freely and are masked with Size - 1 to address the buffer. */
+typedef struct
+{
+    uint32 Magic;
+    uint32 Size;
+    uint32 Cpu_Frequency;
+    volatile uint32 Write_Index;
+    volatile uint32 Read_Index;
+    uint32 Read_Timestamp;     /* cycle counter the record at Read_Index is relative to */
+    uint32 Last_Timestamp;     /* cycle counter of the last stored record */
+    volatile uint32 Dropped;   /* records overwritten or lost because the buffer was full */
+    uint8 Buffer[TRACE_BUFFER_SIZE];
+}Trace_ControlBlockType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: Trace_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to empty the trace buffer and start recording. The
+  timestamps come from the DWT cycle counter started by Profiler_Init().
+**********************************************************************/
+void Trace_Init(void);
+
+/*********************************************************************
+* Service Name: Trace_Record
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Event - type of the record / Arg - event argument
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to append one record. When the buffer is full the oldest
+  whole records are overwritten, or with TRACE_OVERWRITE FALSE the new record is
+  dropped. Either way the lost records are counted.
+**********************************************************************/
+void Trace_Record(Trace_EventType Event, uint32 Arg);
+
+/*********************************************************************
+* Service Name: Trace_Read
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Size - size of the destination buffer
+* Parameters (inout): None
+* Parameters (out): Buffer_Ptr - copied records
+* Return value: uint32 - number of bytes copied, always whole records
+* Description: Function to move the oldest records out of the trace buffer to
+  free space for new ones. There must be a single reader. Each record is taken
+  with the interrupts disabled, Trace_Record() may overwrite it otherwise.
+**********************************************************************/
+uint32 Trace_Read(uint8 *Buffer_Ptr, uint32 Size);
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,826 @@
+ /******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: UART.c
+ *
+ * Description: Source file for the UART0 driver
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "UART.h"
+#include "UDMA.h"
+#include "NVIC.h"
+#include "RegInit.h"
+#include "interruptsControl.h"
+#include "Trace.h"
+#include "FPU.h"
+#include "Log.h"
+#include "RamFunc.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define UART_UART0_CLOCK_MASK                0x01u
+#define UART_PORTA_CLOCK_MASK                0x01u
+
+/* PA0 (U0RX) and PA1 (U0TX) */
+#define UART_PINS_MASK                       0x03u
+#define UART_PINS_PCTL_MASK                  0x000000FFu
+#define UART_PINS_PCTL_VALUE                 0x00000011u
+
+#define UART_FR_RXFE_MASK                    0x00000010u
+#define UART_FR_TXFF_MASK                    0x00000020u
+
+#define UART_LCRH_FEN_MASK                   0x00000010u
+#define UART_LCRH_WLEN_8                     0x00000060u
+
+#define UART_CTL_UARTEN_MASK                 0x00000001u
+#define UART_CTL_HSE_MASK                    0x00000020u
+#define UART_CTL_TXE_MASK                    0x00000100u
+#define UART_CTL_RXE_MASK                    0x00000200u
+
+/* Interrupt at half FIFO: 8 of 16 bytes left to send or received */
+#define UART_IFLS_TX_HALF                    0x00000002u
+#define UART_IFLS_RX_HALF                    0x00000010u
+
+/* IM, MIS and ICR bits */
+#define UART_INT_RX_MASK                     0x00000010u
+#define UART_INT_TX_MASK                     0x00000020u
+#define UART_INT_RT_MASK                     0x00000040u
+#define UART_INT_OE_MASK                     0x00000400u
+#define UART_INT_ALL_MASK                    0x000007F2u
+
+/* Framing, parity, break and overrun flags read with every byte of DR */
+#define UART_DR_ERRORS_MASK                  0x00000F00u
+
+#define UART_DMACTL_RXDMAE_MASK              0x00000001u
+#define UART_DMACTL_TXDMAE_MASK              0x00000002u
+
+/* RX stream: bytes from DR to the buffer, 8 at a time on the half FIFO burst
+ * request. The channel ignores single requests, so the last bytes of a frame
+ * stay in the FIFO and raise the receive timeout */
+#define UART_RX_DMA_CONTROL                  UDMA_CONTROL(UDMA_SIZE_8, UDMA_INC_NONE, UDMA_INC_8, UDMA_ARB_8)
+
+/* TX queue: bytes from the buffer to DR, 8 at a time while the FIFO is at most
+ * half full, single requests for the rest */
+#define UART_TX_DMA_CONTROL                  UDMA_CONTROL(UDMA_SIZE_8, UDMA_INC_8, UDMA_INC_NONE, UDMA_ARB_8)
+
+/* Primary and alternate structure of the RX channel */
+#define UART_RX_HALVES_NUM                   2u
+
+/*******************************************************************************
+ *                           Private Data Types                                *
+ *******************************************************************************/
+
+/* Free running indices, the ring holds Head - Tail bytes. The producer owns
+ * Head and the consumer owns Tail, so neither side needs a lock */
+typedef struct
+{
+    volatile uint32 Head;
+    volatile uint32 Tail;
+}UART_RingType;
+
+typedef struct
+{
+    const uint8 *Data_Ptr;
+    uint16 Size;
+    UART_TxCallBackType CallBack_Ptr;
+}UART_TxRefType;
+
+typedef enum
+{
+    UART_RX_HALF_ARMED,    /* owned by the uDMA */
+    UART_RX_HALF_FULL      /* owned by the application */
+}UART_RxHalfStateType;
+
+typedef struct
+{
+    uint8 *Buffer_Ptr;
+    uint16 Length;
+    UART_RxHalfStateType State;
+}UART_RxHalfType;
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+static uint8 g_UART_TxBuffer[UART_TX_BUFFER_SIZE];
+static uint8 g_UART_RxBuffer[UART_RX_BUFFER_SIZE];
+
+/* TX: UART_Write() produces, the ISR consumes. RX: the ISR produces, UART_Read() consumes */
+static UART_RingType g_UART_TxRing;
+static UART_RingType g_UART_RxRing;
+
+static boolean g_UART_Ready = FALSE;
+
+/* TX queue: UART_QueueTx() produces, the batch completion consumes. The batch
+ * is the Batch_Size references from Tail on, its tasks stay valid until it ends */
+static UART_TxRefType g_UART_TxRefs[UART_TX_QUEUE_SIZE];
+static UART_RingType g_UART_TxQueue;
+static UDMA_ControlEntryType g_UART_TxTasks[UART_TX_QUEUE_SIZE];
+static uint32 g_UART_TxBatchSize = 0;
+static volatile boolean g_UART_TxDmaBusy = FALSE;
+
+/* RX stream: index 0 is the primary structure, 1 the alternate one */
+static UART_RxHalfType g_UART_RxHalves[UART_RX_HALVES_NUM];
+static uint16 g_UART_RxStreamSize = 0;
+static boolean g_UART_RxStreaming = FALSE;
+
+/* Half the uDMA fills now, or fills next once it is released */
+static uint8 g_UART_RxActiveHalf = 0;
+
+/* Full halves in reception order, the ISR produces and UART_GetRxBuffer() consumes */
+static uint8 g_UART_RxFullQueue[UART_RX_HALVES_NUM];
+static UART_RingType g_UART_RxFullRing;
+
+/* Driver counters */
+static volatile UART_StatsType g_UART_Stats;
+
+/* PA0/PA1 as U0RX/U0TX and UART0 held disabled while it is configured */
+static const RegInit_StepType g_UART_InitSequence[] =
+{
+    REGINIT_MODIFY(SYSCTL_RCGCUART_REG, 0, UART_UART0_CLOCK_MASK),             /* Enable clock for UART0 */
+    REGINIT_MODIFY(SYSCTL_RCGCGPIO_REG, 0, UART_PORTA_CLOCK_MASK),             /* Enable clock for PORTA */
+    REGINIT_WAIT_SET(SYSCTL_PRUART_REG, UART_UART0_CLOCK_MASK),                /* Wait for the clocks to start */
+    REGINIT_WAIT_SET(SYSCTL_PRGPIO_REG, UART_PORTA_CLOCK_MASK),
+    REGINIT_MODIFY(GPIO_PORTA_AMSEL_REG, UART_PINS_MASK, 0),                   /* Disable Analog on PA0 and PA1 */
+    REGINIT_MODIFY(GPIO_PORTA_PCTL_REG, UART_PINS_PCTL_MASK, UART_PINS_PCTL_VALUE), /* PMC0 and PMC1 = U0RX and U0TX */
+    REGINIT_MODIFY(GPIO_PORTA_AFSEL_REG, 0, UART_PINS_MASK),                   /* Enable alternative function on PA0 and PA1 */
+    REGINIT_MODIFY(GPIO_PORTA_DEN_REG, 0, UART_PINS_MASK),                     /* Enable Digital I/O on PA0 and PA1 */
+    REGINIT_WRITE(UART0_CTL_REG, 0),                                           /* Disable UART0 */
+    REGINIT_WRITE(UART0_DMACTL_REG, 0),                                        /* No uDMA requests */
+    REGINIT_WRITE(UART0_IFLS_REG, UART_IFLS_TX_HALF | UART_IFLS_RX_HALF),     /* Half FIFO interrupt levels */
+    REGINIT_WRITE(UART0_ICR_REG, UART_INT_ALL_MASK)                            /* Clear all interrupt flags */
+};
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Move bytes from the TX ring to the TX FIFO until one of them is full/empty.
+ * Called by the ISR, or by UART_Write() with the TX interrupt masked */
+static RAMFUNC void UART_FillTxFifo(void)
+{
+    uint32 tail = g_UART_TxRing.Tail;
+    uint32 head = g_UART_TxRing.Head;
+
+    while (tail != head && !(UART0->FR & UART_FR_TXFF_MASK))
+    {
+        UART0->DR = g_UART_TxBuffer[tail & (UART_TX_BUFFER_SIZE - 1)];
+        tail++;
+    }
+    g_UART_Stats.Tx_Bytes += tail - g_UART_TxRing.Tail;
+    g_UART_TxRing.Tail = tail;
+}
+
+/* Send the whole TX queue in one batch: one peripheral scatter-gather task per
+ * buffer and a single completion at the end. The TX interrupt is masked while
+ * the uDMA feeds the FIFO */
+static RAMFUNC void UART_TxDmaStart(void)
+{
+    uint32 tail = g_UART_TxQueue.Tail;
+    uint32 count = g_UART_TxQueue.Head - tail;
+    const UART_TxRefType *ref_ptr;
+    uint32 task;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    for (task = 0; task < count; task++)
+    {
+        ref_ptr = &g_UART_TxRefs[(tail + task) & (UART_TX_QUEUE_SIZE - 1)];
+        (void)UDMA_SetTask(&g_UART_TxTasks[task], UART_TX_DMA_CONTROL,
+                           (task == count - 1) ? UDMA_MODE_BASIC : UDMA_MODE_PERIPH_SG_TASK,
+                           ref_ptr->Data_Ptr, &UART0->DR, ref_ptr->Size);
+    }
+    g_UART_TxBatchSize = count;
+
+    UDMA_AssignChannel(UART0_TX_DMA_CHANNEL, UART0_DMA_ENCODING);
+    UDMA_SetChannelAttributes(UART0_TX_DMA_CHANNEL, FALSE, FALSE);
+    if (count == 1)
+    {
+        ref_ptr = &g_UART_TxRefs[tail & (UART_TX_QUEUE_SIZE - 1)];
+        (void)UDMA_SetTransfer(UART0_TX_DMA_CHANNEL, FALSE, UART_TX_DMA_CONTROL, UDMA_MODE_BASIC,
+                               ref_ptr->Data_Ptr, &UART0->DR, ref_ptr->Size);
+    }
+    else
+    {
+        (void)UDMA_SetScatterGather(UART0_TX_DMA_CHANNEL, g_UART_TxTasks, (uint8)count, TRUE);
+    }
+    UDMA_SelectStructure(UART0_TX_DMA_CHANNEL, FALSE);
+
+    g_UART_TxDmaBusy = TRUE;
+    UART0->IM &= ~UART_INT_TX_MASK;
+    UART0->DMACTL |= UART_DMACTL_TXDMAE_MASK;
+    UDMA_EnableChannel(UART0_TX_DMA_CHANNEL);
+}
+
+/* Feed the TX FIFO from the ring, or once the ring is empty from the TX queue.
+ * The two never share the FIFO, so their bytes do not interleave. Called with
+ * the interrupts disabled: UART_QueueTx() may run in a higher priority ISR */
+static RAMFUNC void UART_TxKick(void)
+{
+    if (g_UART_TxDmaBusy)
+    {
+        return;
+    }
+
+    UART_FillTxFifo();
+    if (g_UART_TxRing.Tail == g_UART_TxRing.Head)
+    {
+        UART_TxDmaStart();
+    }
+}
+
+/* End of a TX batch: give the buffers back, then serve UART_Write() first */
+static RAMFUNC void UART_TxDmaCompletion(void)
+{
+    uint32 tail = g_UART_TxQueue.Tail;
+    const UART_TxRefType *ref_ptr;
+    uint32 primask;
+    uint32 ref;
+
+    if (!g_UART_TxDmaBusy || !UDMA_AckCompletion(UART0_TX_DMA_CHANNEL))
+    {
+        return;
+    }
+
+    /* Still busy: a buffer queued by a callback waits for the next batch */
+    for (ref = 0; ref < g_UART_TxBatchSize; ref++)
+    {
+        ref_ptr = &g_UART_TxRefs[(tail + ref) & (UART_TX_QUEUE_SIZE - 1)];
+        g_UART_Stats.Tx_Bytes += ref_ptr->Size;
+        if (ref_ptr->CallBack_Ptr != NULL_PTR)
+        {
+            (*ref_ptr->CallBack_Ptr)(ref_ptr->Data_Ptr);
+        }
+    }
+    g_UART_Stats.Tx_Batches++;
+
+    primask = Interrupts_DisableSave();
+    g_UART_TxQueue.Tail = tail + g_UART_TxBatchSize;
+    g_UART_TxDmaBusy = FALSE;
+    UART0->IM |= UART_INT_TX_MASK;
+    UART_TxKick();
+    if (!g_UART_TxDmaBusy)
+    {
+        /* No next batch: the TX FIFO requests must not reach the uDMA */
+        UART0->DMACTL &= ~UART_DMACTL_TXDMAE_MASK;
+    }
+    Interrupts_Restore(primask);
+}
+
+/* Move every byte of the RX FIFO to the RX ring, called by the ISR only */
+static RAMFUNC void UART_DrainRxFifo(void)
+{
+    uint32 head = g_UART_RxRing.Head;
+    uint32 data;
+
+    while (!(UART0->FR & UART_FR_RXFE_MASK))
+    {
+        data = UART0->DR;
+        if (data & UART_DR_ERRORS_MASK)
+        {
+            g_UART_Stats.Rx_Errors++;
+        }
+
+        if ((head - g_UART_RxRing.Tail) < UART_RX_BUFFER_SIZE)
+        {
+            g_UART_RxBuffer[head & (UART_RX_BUFFER_SIZE - 1)] = (uint8)data;
+            head++;
+            g_UART_Stats.Rx_Bytes++;
+        }
+        else
+        {
+            g_UART_Stats.Rx_Dropped++;
+        }
+    }
+    g_UART_RxRing.Head = head;
+}
+
+/* Give a half to the uDMA, it fills the buffer from the byte First on */
+static RAMFUNC void UART_RxArm(uint8 Half, uint16 First)
+{
+    UART_RxHalfType *half_ptr = &g_UART_RxHalves[Half];
+
+    half_ptr->State = UART_RX_HALF_ARMED;
+    (void)UDMA_SetTransfer(UART0_RX_DMA_CHANNEL, (boolean)Half, UART_RX_DMA_CONTROL, UDMA_MODE_PINGPONG,
+                           &UART0->DR, half_ptr->Buffer_Ptr + First, g_UART_RxStreamSize - First);
+}
+
+/* Hand a half over to the application */
+static RAMFUNC void UART_RxDeliver(uint8 Half, uint16 Length)
+{
+    UART_RxHalfType *half_ptr = &g_UART_RxHalves[Half];
+
+    half_ptr->Length = Length;
+    half_ptr->State = UART_RX_HALF_FULL;
+    g_UART_RxFullQueue[g_UART_RxFullRing.Head % UART_RX_HALVES_NUM] = Half;
+    g_UART_RxFullRing.Head++;
+    g_UART_Stats.Rx_Bytes += Length;
+    g_UART_Stats.Rx_Buffers++;
+}
+
+/* Deliver the halves the uDMA has completed, in the order it filled them. After
+ * the last armed half the uDMA disables the channel by itself */
+static RAMFUNC void UART_RxStreamCompletion(void)
+{
+    uint8 active = g_UART_RxActiveHalf;
+
+    while (g_UART_RxHalves[active].State == UART_RX_HALF_ARMED &&
+           UDMA_GetMode(UART0_RX_DMA_CHANNEL, (boolean)active) == UDMA_MODE_STOP)
+    {
+        UART_RxDeliver(active, g_UART_RxStreamSize);
+        active ^= 1;
+    }
+    g_UART_RxActiveHalf = active;
+}
+
+/* Receive timeout: move the trailing bytes of the FIFO behind the bytes the uDMA
+ * has written and hand the partial buffer over if the other half can take the
+ * next bytes. Otherwise the uDMA continues after the moved bytes */
+static RAMFUNC void UART_RxStreamTimeout(void)
+{
+    UART_RxHalfType *half_ptr;
+    uint8 active;
+    uint16 filled;
+    uint32 data;
+
+    UDMA_DisableChannel(UART0_RX_DMA_CHANNEL);
+    UART_RxStreamCompletion();
+    active = g_UART_RxActiveHalf;
+    half_ptr = &g_UART_RxHalves[active];
+
+    if (half_ptr->State == UART_RX_HALF_ARMED)
+    {
+        filled = g_UART_RxStreamSize - UDMA_GetRemainingItems(UART0_RX_DMA_CHANNEL, (boolean)active);
+        while (filled < g_UART_RxStreamSize && !(UART0->FR & UART_FR_RXFE_MASK))
+        {
+            data = UART0->DR;
+            if (data & UART_DR_ERRORS_MASK)
+            {
+                g_UART_Stats.Rx_Errors++;
+            }
+            half_ptr->Buffer_Ptr[filled++] = (uint8)data;
+        }
+
+        if (filled == g_UART_RxStreamSize ||
+            (filled > 0 && g_UART_RxHalves[active ^ 1].State == UART_RX_HALF_ARMED))
+        {
+            UDMA_StopTransfer(UART0_RX_DMA_CHANNEL, (boolean)active);
+            UART_RxDeliver(active, filled);
+            active ^= 1;
+            g_UART_RxActiveHalf = active;
+        }
+        else if (filled > 0)
+        {
+            UART_RxArm(active, filled);
+        }
+    }
+
+    if (g_UART_RxHalves[active].State == UART_RX_HALF_ARMED)
+    {
+        UDMA_SelectStructure(UART0_RX_DMA_CHANNEL, (boolean)active);
+        UDMA_EnableChannel(UART0_RX_DMA_CHANNEL);
+    }
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: UART0_Handler
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler of the UART0 IRQ. The RX FIFO is emptied on the half
+  level and on the receive timeout, the TX FIFO is refilled on the half level.
+  It also ends the uDMA transfers of UART0.
+**********************************************************************/
+RAMFUNC void UART0_Handler(void)
+{
+    uint32 status;
+    uint32 primask;
+
+    TRACE_ISR_ENTER(TRACE_EXCEPTION_IRQ(UART0_IRQ_NUM));
+    FPU_NOFPU_ISR_ENTER();
+
+    status = UART0->MIS;
+    UART0->ICR = status;
+    g_UART_Stats.Interrupts++;
+
+    if (g_UART_RxStreaming)
+    {
+        /* The uDMA completion is signalled on this IRQ */
+        (void)UDMA_AckCompletion(UART0_RX_DMA_CHANNEL);
+        UART_RxStreamCompletion();
+        if (status & UART_INT_RT_MASK)
+        {
+            UART_RxStreamTimeout();
+        }
+        if (status & UART_INT_OE_MASK)
+        {
+            g_UART_Stats.Rx_Errors++;
+        }
+    }
+    else if (status & (UART_INT_RX_MASK | UART_INT_RT_MASK | UART_INT_OE_MASK))
+    {
+        UART_DrainRxFifo();
+    }
+    if (status & UART_INT_TX_MASK)
+    {
+        primask = Interrupts_DisableSave();
+        UART_TxKick();
+        Interrupts_Restore(primask);
+    }
+    UART_TxDmaCompletion();
+
+    FPU_NOFPU_ISR_EXIT(TRACE_EXCEPTION_IRQ(UART0_IRQ_NUM));
+    TRACE_ISR_EXIT(TRACE_EXCEPTION_IRQ(UART0_IRQ_NUM));
+}
+
+/*********************************************************************
+* Service Name: UART_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Config_Ptr - line settings
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the baud rate cannot be reached with UART_CLOCK_HZ
+* Description: Function to set up PA0/PA1 and UART0, empty the ring buffers and
+  enable the UART0 IRQ. The IRQ priority is left to the caller.
+**********************************************************************/
+CODE_COLD boolean UART_Init(const UART_ConfigType *Config_Ptr)
+{
+    uint32 ctl = UART_CTL_UARTEN_MASK | UART_CTL_TXE_MASK | UART_CTL_RXE_MASK;
+    uint32 divisor;
+
+    /* 16x oversampling up to UART_CLOCK_HZ / 16, 8x (HSE) up to UART_CLOCK_HZ / 8 */
+    if (Config_Ptr == NULL_PTR || Config_Ptr->Baud_Rate == 0 || Config_Ptr->Baud_Rate > UART_CLOCK_HZ / 8)
+    {
+        LOG_0(LOG_LEVEL_ERROR, "UART_Init: invalid baud rate");
+        return FALSE;
+    }
+    if (Config_Ptr->Baud_Rate > UART_CLOCK_HZ / 16)
+    {
+        ctl |= UART_CTL_HSE_MASK;
+    }
+
+    /* Divisor in 1/64 steps, rounded: IBRD is the integer part and FBRD the fraction */
+    divisor = (ctl & UART_CTL_HSE_MASK) ? (UART_CLOCK_HZ * 16u) : (UART_CLOCK_HZ * 8u);
+    divisor = (divisor / Config_Ptr->Baud_Rate + 1) / 2;
+
+    g_UART_Ready = FALSE;
+    g_UART_RxStreaming = FALSE;
+    g_UART_TxDmaBusy = FALSE;
+    NVIC_DisableIRQ(UART0_IRQ_NUM);
+    RegInit_Execute(g_UART_InitSequence, REGINIT_STEPS_NUM(g_UART_InitSequence));
+
+    g_UART_TxRing.Head = 0;
+    g_UART_TxRing.Tail = 0;
+    g_UART_RxRing.Head = 0;
+    g_UART_RxRing.Tail = 0;
+    g_UART_TxQueue.Head = 0;
+    g_UART_TxQueue.Tail = 0;
+
+    UART0->IBRD = divisor >> 6;
+    UART0->FBRD = divisor & 0x3F;
+    UART0->LCRH = UART_LCRH_WLEN_8 | UART_LCRH_FEN_MASK;   /* also latches IBRD and FBRD */
+    UART0->IM = UART_INT_RX_MASK | UART_INT_TX_MASK | UART_INT_RT_MASK | UART_INT_OE_MASK;
+    UART0->CTL = ctl;
+
+    g_UART_Ready = TRUE;
+    NVIC_EnableIRQ(UART0_IRQ_NUM);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UART_Write
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Data_Ptr - bytes to send / Size - number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bytes accepted
+* Description: Function to queue bytes for transmission without blocking. The
+  bytes that do not fit in the TX ring are not accepted. All the writes must
+  come from the same context.
+**********************************************************************/
+CODE_HOT uint32 UART_Write(const uint8 *Data_Ptr, uint32 Size)
+{
+    uint32 head = g_UART_TxRing.Head;
+    uint32 free = UART_TX_BUFFER_SIZE - (head - g_UART_TxRing.Tail);
+    uint32 primask;
+    uint32 i;
+
+    if (!g_UART_Ready || Data_Ptr == NULL_PTR)
+    {
+        return 0;
+    }
+
+    if (Size > free)
+    {
+        Size = free;
+    }
+    for (i = 0; i < Size; i++)
+    {
+        g_UART_TxBuffer[(head + i) & (UART_TX_BUFFER_SIZE - 1)] = Data_Ptr[i];
+    }
+    g_UART_TxRing.Head = head + Size;
+
+    /* The TX interrupt only fires when the FIFO level crosses the trigger, so an
+     * idle FIFO is primed here. While a TX queue batch runs the bytes wait for
+     * its completion */
+    primask = Interrupts_DisableSave();
+    UART_TxKick();
+    Interrupts_Restore(primask);
+
+    return Size;
+}
+
+/*********************************************************************
+* Service Name: UART_GetTxFree
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - free bytes in the TX ring
+* Description: Function to read how many bytes UART_Write() would accept now.
+**********************************************************************/
+uint32 UART_GetTxFree(void)
+{
+    return UART_TX_BUFFER_SIZE - (g_UART_TxRing.Head - g_UART_TxRing.Tail);
+}
+
+/*********************************************************************
+* Service Name: UART_QueueTx
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): Data_Ptr - bytes to send / Size - number of bytes (1 - UART_TX_QUEUE_MAX_SIZE) /
+                   CallBack_Ptr - called once the bytes are sent, may be NULL_PTR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the queue is full or the buffer is not usable
+* Description: Function to send a buffer without copying it, the buffer must not
+  change until it is sent. The buffers queued while a batch runs go out in the
+  next batch, after the bytes of UART_Write(). Can be called from any ISR,
+  needs UDMA_Init().
+**********************************************************************/
+CODE_HOT boolean UART_QueueTx(const uint8 *Data_Ptr, uint16 Size, UART_TxCallBackType CallBack_Ptr)
+{
+    UART_TxRefType *ref_ptr;
+    uint32 primask;
+    uint32 head;
+
+    if (!g_UART_Ready || Data_Ptr == NULL_PTR || Size == 0 || Size > UART_TX_QUEUE_MAX_SIZE)
+    {
+        return FALSE;
+    }
+
+    primask = Interrupts_DisableSave();
+    head = g_UART_TxQueue.Head;
+    if ((head - g_UART_TxQueue.Tail) >= UART_TX_QUEUE_SIZE)
+    {
+        Interrupts_Restore(primask);
+        return FALSE;
+    }
+
+    ref_ptr = &g_UART_TxRefs[head & (UART_TX_QUEUE_SIZE - 1)];
+    ref_ptr->Data_Ptr = Data_Ptr;
+    ref_ptr->Size = Size;
+    ref_ptr->CallBack_Ptr = CallBack_Ptr;
+    g_UART_TxQueue.Head = head + 1;
+
+    UART_TxKick();
+    Interrupts_Restore(primask);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UART_GetTxQueueFree
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - free entries in the TX queue
+* Description: Function to read how many buffers UART_QueueTx() would accept now.
+**********************************************************************/
+uint32 UART_GetTxQueueFree(void)
+{
+    return UART_TX_QUEUE_SIZE - (g_UART_TxQueue.Head - g_UART_TxQueue.Tail);
+}
+
+/*********************************************************************
+* Service Name: UART_Read
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Size - size of the destination buffer
+* Parameters (inout): None
+* Parameters (out): Data_Ptr - received bytes
+* Return value: uint32 - number of bytes read, 0 if nothing was received
+* Description: Function to take the received bytes without blocking. All the
+  reads must come from the same context.
+**********************************************************************/
+uint32 UART_Read(uint8 *Data_Ptr, uint32 Size)
+{
+    uint32 tail = g_UART_RxRing.Tail;
+    uint32 available = g_UART_RxRing.Head - tail;
+    uint32 i;
+
+    if (Data_Ptr == NULL_PTR)
+    {
+        return 0;
+    }
+
+    if (Size > available)
+    {
+        Size = available;
+    }
+    for (i = 0; i < Size; i++)
+    {
+        Data_Ptr[i] = g_UART_RxBuffer[(tail + i) & (UART_RX_BUFFER_SIZE - 1)];
+    }
+    g_UART_RxRing.Tail = tail + Size;
+    return Size;
+}
+
+/*********************************************************************
+* Service Name: UART_StartRxStream
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Buffer_A_Ptr - first buffer / Buffer_B_Ptr - second buffer / Size - size of each buffer (1 - UART_RX_STREAM_MAX_SIZE)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the driver or the buffers are not usable
+* Description: Function to receive through uDMA ping-pong transfers instead of
+  the RX ring. A buffer is handed over when it is full or when the line stays
+  idle after a partial frame (receive timeout). Needs UDMA_Init().
+**********************************************************************/
+CODE_COLD boolean UART_StartRxStream(uint8 *Buffer_A_Ptr, uint8 *Buffer_B_Ptr, uint16 Size)
+{
+    if (!g_UART_Ready || Buffer_A_Ptr == NULL_PTR || Buffer_B_Ptr == NULL_PTR ||
+        Size == 0 || Size > UART_RX_STREAM_MAX_SIZE)
+    {
+        LOG_0(LOG_LEVEL_ERROR, "UART_StartRxStream: invalid buffers");
+        return FALSE;
+    }
+
+    NVIC_DisableIRQ(UART0_IRQ_NUM);
+
+    /* The uDMA drains the RX FIFO from now on, only the timeout is left to the ISR */
+    UART0->IM &= ~UART_INT_RX_MASK;
+    UDMA_AssignChannel(UART0_RX_DMA_CHANNEL, UART0_DMA_ENCODING);
+    UDMA_SetChannelAttributes(UART0_RX_DMA_CHANNEL, TRUE, TRUE);
+
+    g_UART_RxStreamSize = Size;
+    g_UART_RxHalves[0].Buffer_Ptr = Buffer_A_Ptr;
+    g_UART_RxHalves[1].Buffer_Ptr = Buffer_B_Ptr;
+    UART_RxArm(0, 0);
+    UART_RxArm(1, 0);
+    g_UART_RxActiveHalf = 0;
+    g_UART_RxFullRing.Head = 0;
+    g_UART_RxFullRing.Tail = 0;
+
+    UDMA_SelectStructure(UART0_RX_DMA_CHANNEL, FALSE);
+    UDMA_EnableChannel(UART0_RX_DMA_CHANNEL);
+    g_UART_RxStreaming = TRUE;
+    UART0->DMACTL |= UART_DMACTL_RXDMAE_MASK;
+
+    NVIC_EnableIRQ(UART0_IRQ_NUM);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UART_StopRxStream
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to go back to the RX ring, the data not handed over
+  yet is dropped.
+**********************************************************************/
+void UART_StopRxStream(void)
+{
+    if (!g_UART_RxStreaming)
+    {
+        return;
+    }
+
+    NVIC_DisableIRQ(UART0_IRQ_NUM);
+    UART0->DMACTL &= ~UART_DMACTL_RXDMAE_MASK;
+    UDMA_DisableChannel(UART0_RX_DMA_CHANNEL);
+    g_UART_RxStreaming = FALSE;
+    UART0->IM |= UART_INT_RX_MASK;
+    NVIC_EnableIRQ(UART0_IRQ_NUM);
+}
+
+/*********************************************************************
+* Service Name: UART_GetRxBuffer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Buffer_Ptr - the next received buffer
+* Return value: boolean - FALSE if no buffer is ready
+* Description: Function to take the next buffer of the RX stream, in order.
+**********************************************************************/
+CODE_HOT boolean UART_GetRxBuffer(UART_RxBufferType *Buffer_Ptr)
+{
+    uint32 tail = g_UART_RxFullRing.Tail;
+    const UART_RxHalfType *half_ptr;
+
+    if (Buffer_Ptr == NULL_PTR || tail == g_UART_RxFullRing.Head)
+    {
+        return FALSE;
+    }
+
+    half_ptr = &g_UART_RxHalves[g_UART_RxFullQueue[tail % UART_RX_HALVES_NUM]];
+    Buffer_Ptr->Data_Ptr = half_ptr->Buffer_Ptr;
+    Buffer_Ptr->Length = half_ptr->Length;
+    g_UART_RxFullRing.Tail = tail + 1;
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UART_ReleaseRxBuffer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Data_Ptr - Data_Ptr of a buffer from UART_GetRxBuffer()
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to give a buffer back to the uDMA. While both buffers
+  are held by the application the RX FIFO overflows.
+**********************************************************************/
+CODE_HOT void UART_ReleaseRxBuffer(const uint8 *Data_Ptr)
+{
+    uint32 primask;
+    uint8 half;
+    boolean stopped;
+
+    primask = Interrupts_DisableSave();
+    for (half = 0; half < UART_RX_HALVES_NUM; half++)
+    {
+        if (g_UART_RxStreaming && g_UART_RxHalves[half].Buffer_Ptr == Data_Ptr &&
+            g_UART_RxHalves[half].State == UART_RX_HALF_FULL)
+        {
+            /* The uDMA may have completed the other half before the ISR ran:
+             * deliver it first, it must not be restarted over */
+            (void)UDMA_AckCompletion(UART0_RX_DMA_CHANNEL);
+            UART_RxStreamCompletion();
+            stopped = (boolean)(!UDMA_IsChannelEnabled(UART0_RX_DMA_CHANNEL) &&
+                                g_UART_RxHalves[g_UART_RxActiveHalf].State != UART_RX_HALF_ARMED);
+
+            UART_RxArm(half, 0);
+            if (stopped)
+            {
+                /*no half is armed any more, the uDMA stopped: restart on this one*/
+                g_UART_RxActiveHalf = half;
+                UDMA_SelectStructure(UART0_RX_DMA_CHANNEL, (boolean)half);
+                UDMA_EnableChannel(UART0_RX_DMA_CHANNEL);
+            }
+            break;
+        }
+    }
+    Interrupts_Restore(primask);
+}
+
+/*********************************************************************
+* Service Name: UART_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Stats_Ptr - driver counters
+* Return value: None
+* Description: Function to read the byte, error and interrupt counters.
+**********************************************************************/
+void UART_GetStats(UART_StatsType *Stats_Ptr)
+{
+    if (Stats_Ptr == NULL_PTR)
+    {
+        return;
+    }
+    Stats_Ptr->Tx_Bytes = g_UART_Stats.Tx_Bytes;
+    Stats_Ptr->Tx_Batches = g_UART_Stats.Tx_Batches;
+    Stats_Ptr->Rx_Bytes = g_UART_Stats.Rx_Bytes;
+    Stats_Ptr->Rx_Dropped = g_UART_Stats.Rx_Dropped;
+    Stats_Ptr->Rx_Errors = g_UART_Stats.Rx_Errors;
+    Stats_Ptr->Rx_Buffers = g_UART_Stats.Rx_Buffers;
+    Stats_Ptr->Interrupts = g_UART_Stats.Interrupts;
+}
@@ -0,0 +1,238 @@
+ /******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: UART.h
+ *
+ * Description: Header file for the UART0 driver (PA0 RX, PA1 TX, the virtual
+ *              COM port of the LaunchPad). TX and RX go through lock-free
+ *              single producer single consumer ring buffers, the interrupt
+ *              is raised at half FIFO level, so every interrupt moves up to 8
+ *              bytes, and the receive timeout flushes the trailing bytes.
+ *              The RX stream mode lets the uDMA fill two application buffers
+ *              in turn and hands them over without copying. The TX queue
+ *              sends application buffers by reference, all the queued ones
+ *              in one uDMA scatter-gather batch with one interrupt
+ *
+ *******************************************************************************/
+
+#ifndef UART_H_
+#define UART_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "SysTick.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* UART module clock, the system clock. The baud rate can go up to a sixteenth of
+ * it, or an eighth with 8x oversampling: 1 Mbaud at 16 MHz, 10 Mbaud at 80 MHz */
+#ifndef UART_CLOCK_HZ
+#define UART_CLOCK_HZ                        ((uint32)SYS_FREQ)
+#endif
+
+#define UART0_IRQ_NUM                        5u
+
+/* uDMA channels of UART0, encoding 0 in CHMAP1 */
+#define UART0_RX_DMA_CHANNEL                 8u
+#define UART0_TX_DMA_CHANNEL                 9u
+#define UART0_DMA_ENCODING                   0u
+
+/* Largest buffer of the RX stream, one uDMA transfer */
+#define UART_RX_STREAM_MAX_SIZE              1024u
+
+/* Buffer references of the TX queue, a power of two, and the largest buffer:
+ * one uDMA task each */
+#define UART_TX_QUEUE_SIZE                   16u
+#define UART_TX_QUEUE_MAX_SIZE               1024u
+
+/* Ring buffer sizes, powers of two */
+#define UART_TX_BUFFER_SIZE                  512u
+#define UART_RX_BUFFER_SIZE                  256u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* 8 data bits, no parity, 1 stop bit */
+typedef struct
+{
+    uint32 Baud_Rate;
+}UART_ConfigType;
+
+typedef struct
+{
+    uint32 Tx_Bytes;       /* bytes written to the TX FIFO */
+    uint32 Tx_Batches;     /* uDMA batches of the TX queue */
+    uint32 Rx_Bytes;       /* bytes stored in the RX ring */
+    uint32 Rx_Dropped;     /* bytes lost because the RX ring was full */
+    uint32 Rx_Errors;      /* framing, parity, break and FIFO overrun errors */
+    uint32 Rx_Buffers;     /* buffers handed over by the RX stream */
+    uint32 Interrupts;
+}UART_StatsType;
+
+/* Called in the UART0 ISR once a queued buffer is sent, it belongs to the
+ * application again */
+typedef void (*UART_TxCallBackType)(const uint8 *Data_Ptr);
+
+/* Received data of the RX stream, it belongs to the application until
+ * UART_ReleaseRxBuffer() */
+typedef struct
+{
+    uint8 *Data_Ptr;
+    uint16 Length;
+}UART_RxBufferType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: UART_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Config_Ptr - line settings
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the baud rate cannot be reached with UART_CLOCK_HZ
+* Description: Function to set up PA0/PA1 and UART0, empty the ring buffers and
+  enable the UART0 IRQ. The IRQ priority is left to the caller.
+**********************************************************************/
+boolean UART_Init(const UART_ConfigType *Config_Ptr);
+
+/*********************************************************************
+* Service Name: UART_Write
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Data_Ptr - bytes to send / Size - number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bytes accepted
+* Description: Function to queue bytes for transmission without blocking. The
+  bytes that do not fit in the TX ring are not accepted. All the writes must
+  come from the same context.
+**********************************************************************/
+uint32 UART_Write(const uint8 *Data_Ptr, uint32 Size);
+
+/*********************************************************************
+* Service Name: UART_GetTxFree
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - free bytes in the TX ring
+* Description: Function to read how many bytes UART_Write() would accept now.
+**********************************************************************/
+uint32 UART_GetTxFree(void);
+
+/*********************************************************************
+* Service Name: UART_QueueTx
+* Sync/Async: Asynchronous
+* Reentrancy: reentrant
+* Parameters (in): Data_Ptr - bytes to send / Size - number of bytes (1 - UART_TX_QUEUE_MAX_SIZE) /
+                   CallBack_Ptr - called once the bytes are sent, may be NULL_PTR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the queue is full or the buffer is not usable
+* Description: Function to send a buffer without copying it, the buffer must not
+  change until it is sent. The buffers queued while a batch runs go out in the
+  next batch, after the bytes of UART_Write(). Can be called from any ISR,
+  needs UDMA_Init().
+**********************************************************************/
+boolean UART_QueueTx(const uint8 *Data_Ptr, uint16 Size, UART_TxCallBackType CallBack_Ptr);
+
+/*********************************************************************
+* Service Name: UART_GetTxQueueFree
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - free entries in the TX queue
+* Description: Function to read how many buffers UART_QueueTx() would accept now.
+**********************************************************************/
+uint32 UART_GetTxQueueFree(void);
+
+/*********************************************************************
+* Service Name: UART_Read
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Size - size of the destination buffer
+* Parameters (inout): None
+* Parameters (out): Data_Ptr - received bytes
+* Return value: uint32 - number of bytes read, 0 if nothing was received
+* Description: Function to take the received bytes without blocking. All the
+  reads must come from the same context.
+**********************************************************************/
+uint32 UART_Read(uint8 *Data_Ptr, uint32 Size);
+
+/*********************************************************************
+* Service Name: UART_StartRxStream
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Buffer_A_Ptr - first buffer / Buffer_B_Ptr - second buffer / Size - size of each buffer (1 - UART_RX_STREAM_MAX_SIZE)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the driver or the buffers are not usable
+* Description: Function to receive through uDMA ping-pong transfers instead of
+  the RX ring. A buffer is handed over when it is full or when the line stays
+  idle after a partial frame (receive timeout). Needs UDMA_Init().
+**********************************************************************/
+boolean UART_StartRxStream(uint8 *Buffer_A_Ptr, uint8 *Buffer_B_Ptr, uint16 Size);
+
+/*********************************************************************
+* Service Name: UART_StopRxStream
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to go back to the RX ring, the data not handed over
+  yet is dropped.
+**********************************************************************/
+void UART_StopRxStream(void);
+
+/*********************************************************************
+* Service Name: UART_GetRxBuffer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Buffer_Ptr - the next received buffer
+* Return value: boolean - FALSE if no buffer is ready
+* Description: Function to take the next buffer of the RX stream, in order.
+**********************************************************************/
+boolean UART_GetRxBuffer(UART_RxBufferType *Buffer_Ptr);
+
+/*********************************************************************
+* Service Name: UART_ReleaseRxBuffer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Data_Ptr - Data_Ptr of a buffer from UART_GetRxBuffer()
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to give a buffer back to the uDMA. While both buffers
+  are held by the application the RX FIFO overflows.
+**********************************************************************/
+void UART_ReleaseRxBuffer(const uint8 *Data_Ptr);
+
+/*********************************************************************
+* Service Name: UART_GetStats
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Stats_Ptr - driver counters
+* Return value: None
+* Description: Function to read the byte, error and interrupt counters.
+**********************************************************************/
+void UART_GetStats(UART_StatsType *Stats_Ptr);
+
+#endif /* UART_H_ */
@@ -0,0 +1,718 @@
+ /******************************************************************************
+ *
+ * Module: UDMA
+ *
+ * File Name: UDMA.c
+ *
+ * Description: Source file for the micro DMA controller driver
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "UDMA.h"
+#include "NVIC.h"
+#include "Trace.h"
+#include "FPU.h"
+#include "Log.h"
+#include "CodeLayout.h"
+#if (UDMA_BENCHMARK == TRUE)
+#include <string.h>
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+#define UDMA_CLOCK_MASK                      0x01u
+#define UDMA_CFG_MASTEN_MASK                 0x01u
+#define UDMA_ERRCLR_MASK                     0x01u
+
+/* Fields of the channel control word */
+#define UDMA_CHCTL_DSTINC_BITS_POS           30u
+#define UDMA_CHCTL_SRCINC_BITS_POS           26u
+#define UDMA_CHCTL_INC_MASK                  0x3u
+#define UDMA_CHCTL_XFERSIZE_BITS_POS         4u
+#define UDMA_CHCTL_XFERSIZE_MASK             0x00003FF0u
+#define UDMA_CHCTL_XFERMODE_MASK             0x00000007u
+
+/* CHMAPn: 8 channels per register, 4 bits each */
+#define UDMA_CHMAP_CHANNELS_PER_REG          8u
+#define UDMA_CHMAP_FIELD_MASK                0xFu
+
+/* Words of one control structure, copied per task in scatter-gather mode */
+#define UDMA_ENTRY_WORDS                     4u
+
+#define UDMA_CHANNEL_MASK(CHANNEL)           (1uL << (CHANNEL))
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Primary structures of the channels 0 - 31, then their alternate structures.
+ * The controller requires the table to be aligned to its 1 KB size */
+#pragma DATA_ALIGN(g_UDMA_ControlTable, 1024)
+static UDMA_ControlEntryType g_UDMA_ControlTable[2 * UDMA_CHANNELS_NUM];
+
+static UDMA_CallBackType g_UDMA_CallBacks[UDMA_CHANNELS_NUM];
+static uint32 g_UDMA_CallBacksMask = 0;
+
+/* Task list of the running UDMA_MemCopy() */
+static UDMA_ControlEntryType g_UDMA_MemCopyTasks[UDMA_MEMCOPY_MAX_TASKS];
+
+/* Bus errors */
+static volatile uint32 g_UDMA_Errors = 0;
+
+#if (UDMA_BENCHMARK == TRUE)
+static uint32 g_UDMA_BenchmarkSrc[UDMA_BENCHMARK_SIZE / sizeof(uint32)];
+static uint32 g_UDMA_BenchmarkDst[UDMA_BENCHMARK_SIZE / sizeof(uint32)];
+static volatile uint32 g_UDMA_BenchmarkDoneStamp = 0;
+#endif
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+/* Address of the last item, the controller works with end pointers */
+static uint32 UDMA_EndAddress(const volatile void *Address_Ptr, uint32 Increment, uint16 Items)
+{
+    if (Increment == UDMA_INC_NONE)
+    {
+        return (uint32)Address_Ptr;
+    }
+    return (uint32)Address_Ptr + ((uint32)(Items - 1) << Increment);
+}
+
+static UDMA_ControlEntryType* UDMA_GetEntry(UDMA_ChannelType Channel, boolean Alternate)
+{
+    return &g_UDMA_ControlTable[Alternate ? (Channel + UDMA_CHANNELS_NUM) : Channel];
+}
+
+#if (UDMA_BENCHMARK == TRUE)
+static void UDMA_BenchmarkDone(UDMA_ChannelType Channel)
+{
+    (void)Channel;
+    g_UDMA_BenchmarkDoneStamp = DWT_CYCCNT_REG;
+}
+#endif
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: UDMA_Software_Handler
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler of the uDMA software IRQ, it calls the callbacks of the
+  completed software channels.
+**********************************************************************/
+void UDMA_Software_Handler(void)
+{
+    uint32 status;
+    UDMA_ChannelType channel;
+
+    TRACE_ISR_ENTER(TRACE_EXCEPTION_IRQ(UDMA_SOFTWARE_IRQ_NUM));
+    FPU_NOFPU_ISR_ENTER();
+
+    /* Peripheral channels are acknowledged by their own ISRs */
+    status = UDMA->CHIS & (g_UDMA_CallBacksMask | UDMA_CHANNEL_MASK(UDMA_MEMCOPY_CHANNEL));
+    UDMA->CHIS = status;
+    for (channel = 0; status != 0; channel++, status >>= 1)
+    {
+        if ((status & 1u) && g_UDMA_CallBacks[channel] != NULL_PTR)
+        {
+            (*g_UDMA_CallBacks[channel])(channel);
+        }
+    }
+
+    FPU_NOFPU_ISR_EXIT(TRACE_EXCEPTION_IRQ(UDMA_SOFTWARE_IRQ_NUM));
+    TRACE_ISR_EXIT(TRACE_EXCEPTION_IRQ(UDMA_SOFTWARE_IRQ_NUM));
+}
+
+/*********************************************************************
+* Service Name: UDMA_Error_Handler
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Handler of the uDMA error IRQ, the channel of a bus error is
+  disabled by the controller.
+**********************************************************************/
+void UDMA_Error_Handler(void)
+{
+    TRACE_ISR_ENTER(TRACE_EXCEPTION_IRQ(UDMA_ERROR_IRQ_NUM));
+
+    if (UDMA->ERRCLR & UDMA_ERRCLR_MASK)
+    {
+        UDMA->ERRCLR = UDMA_ERRCLR_MASK;
+        g_UDMA_Errors++;
+        LOG_1(LOG_LEVEL_ERROR, "uDMA bus error %u", g_UDMA_Errors);
+    }
+
+    TRACE_ISR_EXIT(TRACE_EXCEPTION_IRQ(UDMA_ERROR_IRQ_NUM));
+}
+
+/*********************************************************************
+* Service Name: UDMA_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the uDMA controller with the channel control
+  table, all the channels disabled, and its software and error IRQs.
+**********************************************************************/
+CODE_COLD void UDMA_Init(void)
+{
+    UDMA_ChannelType channel;
+
+    SYSCTL_RCGCDMA_REG |= UDMA_CLOCK_MASK;
+    while (!(SYSCTL_PRDMA_REG & UDMA_CLOCK_MASK));
+
+    UDMA->CFG = UDMA_CFG_MASTEN_MASK;
+    UDMA->CTLBASE = (uint32)g_UDMA_ControlTable;
+    UDMA->ENACLR = 0xFFFFFFFF;
+    UDMA->ALTCLR = 0xFFFFFFFF;
+    UDMA->CHIS = 0xFFFFFFFF;
+    UDMA->ERRCLR = UDMA_ERRCLR_MASK;
+
+    for (channel = 0; channel < UDMA_CHANNELS_NUM; channel++)
+    {
+        g_UDMA_CallBacks[channel] = NULL_PTR;
+    }
+    g_UDMA_CallBacksMask = 0;
+    g_UDMA_Errors = 0;
+
+    NVIC_EnableIRQ(UDMA_SOFTWARE_IRQ_NUM);
+    NVIC_EnableIRQ(UDMA_ERROR_IRQ_NUM);
+}
+
+/*********************************************************************
+* Service Name: UDMA_AssignChannel
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Encoding - peripheral encoding of the channel (0 - 4)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the peripheral of a channel in its CHMAPn field.
+**********************************************************************/
+void UDMA_AssignChannel(UDMA_ChannelType Channel, uint8 Encoding)
+{
+    volatile uint32 *chmap_ptr;
+    uint32 shift;
+
+    if (Channel >= UDMA_CHANNELS_NUM || Encoding > UDMA_CHMAP_FIELD_MASK)
+    {
+        /*WRONG CHANNEL OR ENCODING DO NOTHING*/
+        return;
+    }
+
+    chmap_ptr = &UDMA->CHMAP0 + (Channel / UDMA_CHMAP_CHANNELS_PER_REG);
+    shift = (Channel % UDMA_CHMAP_CHANNELS_PER_REG) * 4;
+    *chmap_ptr = (*chmap_ptr & ~(UDMA_CHMAP_FIELD_MASK << shift)) | ((uint32)Encoding << shift);
+}
+
+/*********************************************************************
+* Service Name: UDMA_SetChannelAttributes
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / High_Priority - arbitration priority / Burst_Only - ignore single requests
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the priority and burst settings of a channel,
+  unmask its requests and select its primary structure.
+**********************************************************************/
+void UDMA_SetChannelAttributes(UDMA_ChannelType Channel, boolean High_Priority, boolean Burst_Only)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        /*WRONG CHANNEL DO NOTHING*/
+        return;
+    }
+
+    if (High_Priority)
+    {
+        UDMA->PRIOSET = UDMA_CHANNEL_MASK(Channel);
+    }
+    else
+    {
+        UDMA->PRIOCLR = UDMA_CHANNEL_MASK(Channel);
+    }
+
+    if (Burst_Only)
+    {
+        UDMA->USEBURSTSET = UDMA_CHANNEL_MASK(Channel);
+    }
+    else
+    {
+        UDMA->USEBURSTCLR = UDMA_CHANNEL_MASK(Channel);
+    }
+
+    UDMA->REQMASKCLR = UDMA_CHANNEL_MASK(Channel);
+    UDMA->ALTCLR = UDMA_CHANNEL_MASK(Channel);
+}
+
+/*********************************************************************
+* Service Name: UDMA_SetTask
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Control - UDMA_CONTROL() settings / Mode - transfer mode / Src_Ptr - first source item /
+                   Dst_Ptr - first destination item / Items - number of items (1 - UDMA_MAX_ITEMS)
+* Parameters (inout): Entry_Ptr - control structure or scatter-gather task
+* Parameters (out): None
+* Return value: boolean - FALSE if the number of items is out of range
+* Description: Function to fill one control structure, the end pointers are
+  computed from the increments.
+**********************************************************************/
+boolean UDMA_SetTask(UDMA_ControlEntryType *Entry_Ptr, uint32 Control, UDMA_ModeType Mode,
+                     const volatile void *Src_Ptr, volatile void *Dst_Ptr, uint16 Items)
+{
+    if (Entry_Ptr == NULL_PTR || Items == 0 || Items > UDMA_MAX_ITEMS)
+    {
+        return FALSE;
+    }
+
+    Entry_Ptr->SRCENDP = UDMA_EndAddress(Src_Ptr, (Control >> UDMA_CHCTL_SRCINC_BITS_POS) & UDMA_CHCTL_INC_MASK, Items);
+    Entry_Ptr->DSTENDP = UDMA_EndAddress(Dst_Ptr, (Control >> UDMA_CHCTL_DSTINC_BITS_POS) & UDMA_CHCTL_INC_MASK, Items);
+    Entry_Ptr->RESERVED = 0;
+    /* The control word last, it arms the structure */
+    Entry_Ptr->CHCTL = (Control & ~(UDMA_CHCTL_XFERSIZE_MASK | UDMA_CHCTL_XFERMODE_MASK)) |
+                       ((uint32)(Items - 1) << UDMA_CHCTL_XFERSIZE_BITS_POS) | (uint32)Mode;
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UDMA_SetTransfer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure / Control - UDMA_CONTROL() settings /
+                   Mode - transfer mode / Src_Ptr - first source item / Dst_Ptr - first destination item / Items - number of items
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the channel or the number of items is out of range
+* Description: Function to fill the primary or the alternate structure of a channel.
+**********************************************************************/
+boolean UDMA_SetTransfer(UDMA_ChannelType Channel, boolean Alternate, uint32 Control, UDMA_ModeType Mode,
+                         const volatile void *Src_Ptr, volatile void *Dst_Ptr, uint16 Items)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        return FALSE;
+    }
+    return UDMA_SetTask(UDMA_GetEntry(Channel, Alternate), Control, Mode, Src_Ptr, Dst_Ptr, Items);
+}
+
+/*********************************************************************
+* Service Name: UDMA_SetScatterGather
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Tasks_Ptr - task list filled with UDMA_SetTask() / Tasks_Num - number of tasks /
+                   Peripheral - TRUE for a peripheral scatter-gather
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the channel or the number of tasks is out of range
+* Description: Function to make the primary structure copy the tasks one by one
+  to the alternate structure. Every task but the last uses the *_SG_TASK mode,
+  the last one AUTO (memory) or BASIC (peripheral). The list must stay valid
+  until the transfer ends.
+**********************************************************************/
+boolean UDMA_SetScatterGather(UDMA_ChannelType Channel, const UDMA_ControlEntryType *Tasks_Ptr, uint8 Tasks_Num,
+                              boolean Peripheral)
+{
+    UDMA_ControlEntryType *primary_ptr;
+
+    if (Channel >= UDMA_CHANNELS_NUM || Tasks_Ptr == NULL_PTR || Tasks_Num == 0 ||
+        (uint32)Tasks_Num * UDMA_ENTRY_WORDS > UDMA_MAX_ITEMS)
+    {
+        return FALSE;
+    }
+
+    /* Every task is one 4 words burst into the alternate structure: the source
+     * walks the list and the destination end stays on the last alternate word */
+    primary_ptr = UDMA_GetEntry(Channel, FALSE);
+    primary_ptr->SRCENDP = (uint32)&Tasks_Ptr[Tasks_Num - 1].RESERVED;
+    primary_ptr->DSTENDP = (uint32)&UDMA_GetEntry(Channel, TRUE)->RESERVED;
+    primary_ptr->CHCTL = UDMA_CONTROL(UDMA_SIZE_32, UDMA_INC_32, UDMA_INC_32, UDMA_ARB_4) |
+                         ((uint32)(Tasks_Num * UDMA_ENTRY_WORDS - 1) << UDMA_CHCTL_XFERSIZE_BITS_POS) |
+                         (uint32)(Peripheral ? UDMA_MODE_PERIPH_SCATTER_GATHER : UDMA_MODE_MEM_SCATTER_GATHER);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UDMA_GetMode
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: UDMA_ModeType - current mode, UDMA_MODE_STOP once the structure is done
+* Description: Function to find which half of a ping-pong transfer completed.
+**********************************************************************/
+UDMA_ModeType UDMA_GetMode(UDMA_ChannelType Channel, boolean Alternate)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        return UDMA_MODE_STOP;
+    }
+    return (UDMA_ModeType)(UDMA_GetEntry(Channel, Alternate)->CHCTL & UDMA_CHCTL_XFERMODE_MASK);
+}
+
+/*********************************************************************
+* Service Name: UDMA_StopTransfer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a structure to UDMA_MODE_STOP, so a ping-pong
+  transfer ends instead of switching to it.
+**********************************************************************/
+void UDMA_StopTransfer(UDMA_ChannelType Channel, boolean Alternate)
+{
+    UDMA_ControlEntryType *entry_ptr;
+
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        /*WRONG CHANNEL DO NOTHING*/
+        return;
+    }
+    entry_ptr = UDMA_GetEntry(Channel, Alternate);
+    entry_ptr->CHCTL &= ~UDMA_CHCTL_XFERMODE_MASK;
+}
+
+/*********************************************************************
+* Service Name: UDMA_GetRemainingItems
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - items not transferred yet, 0 once the structure is done
+* Description: Function to read the progress of a structure, the controller
+  counts its transfer size down while it runs.
+**********************************************************************/
+uint16 UDMA_GetRemainingItems(UDMA_ChannelType Channel, boolean Alternate)
+{
+    uint32 chctl;
+
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        return 0;
+    }
+
+    chctl = UDMA_GetEntry(Channel, Alternate)->CHCTL;
+    if ((chctl & UDMA_CHCTL_XFERMODE_MASK) == UDMA_MODE_STOP)
+    {
+        return 0;
+    }
+    return (uint16)(((chctl & UDMA_CHCTL_XFERSIZE_MASK) >> UDMA_CHCTL_XFERSIZE_BITS_POS) + 1);
+}
+
+/*********************************************************************
+* Service Name: UDMA_IsAlternateActive
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the channel uses its alternate structure
+* Description: Function to find the structure a ping-pong transfer is filling.
+**********************************************************************/
+boolean UDMA_IsAlternateActive(UDMA_ChannelType Channel)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        return FALSE;
+    }
+    return (UDMA->ALTSET & UDMA_CHANNEL_MASK(Channel)) ? TRUE : FALSE;
+}
+
+/*********************************************************************
+* Service Name: UDMA_SelectStructure
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to choose the structure a disabled channel starts with.
+**********************************************************************/
+void UDMA_SelectStructure(UDMA_ChannelType Channel, boolean Alternate)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        /*WRONG CHANNEL DO NOTHING*/
+        return;
+    }
+
+    if (Alternate)
+    {
+        UDMA->ALTSET = UDMA_CHANNEL_MASK(Channel);
+    }
+    else
+    {
+        UDMA->ALTCLR = UDMA_CHANNEL_MASK(Channel);
+    }
+}
+
+/*********************************************************************
+* Service Name: UDMA_AckCompletion
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the channel completed since the last call
+* Description: Function to clear the completion flag of a peripheral channel,
+  to be called from the peripheral ISR.
+**********************************************************************/
+boolean UDMA_AckCompletion(UDMA_ChannelType Channel)
+{
+    if (Channel >= UDMA_CHANNELS_NUM || !(UDMA->CHIS & UDMA_CHANNEL_MASK(Channel)))
+    {
+        return FALSE;
+    }
+    UDMA->CHIS = UDMA_CHANNEL_MASK(Channel);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UDMA_EnableChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to let a channel start on the next request. The
+  controller disables it again at the end of the transfer.
+**********************************************************************/
+void UDMA_EnableChannel(UDMA_ChannelType Channel)
+{
+    if (Channel < UDMA_CHANNELS_NUM)
+    {
+        UDMA->ENASET = UDMA_CHANNEL_MASK(Channel);
+    }
+}
+
+/*********************************************************************
+* Service Name: UDMA_DisableChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a channel.
+**********************************************************************/
+void UDMA_DisableChannel(UDMA_ChannelType Channel)
+{
+    if (Channel < UDMA_CHANNELS_NUM)
+    {
+        UDMA->ENACLR = UDMA_CHANNEL_MASK(Channel);
+    }
+}
+
+/*********************************************************************
+* Service Name: UDMA_IsChannelEnabled
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE while the channel transfer is not finished
+* Description: Function to poll a channel.
+**********************************************************************/
+boolean UDMA_IsChannelEnabled(UDMA_ChannelType Channel)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        return FALSE;
+    }
+    return (UDMA->ENASET & UDMA_CHANNEL_MASK(Channel)) ? TRUE : FALSE;
+}
+
+/*********************************************************************
+* Service Name: UDMA_RequestChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to issue a software request on an enabled channel.
+**********************************************************************/
+void UDMA_RequestChannel(UDMA_ChannelType Channel)
+{
+    if (Channel < UDMA_CHANNELS_NUM)
+    {
+        UDMA->SWREQ = UDMA_CHANNEL_MASK(Channel);
+    }
+}
+
+/*********************************************************************
+* Service Name: UDMA_SetCallBack
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / CallBack_Ptr - function called at completion, NULL_PTR for none
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the completion callback of a software channel,
+  it runs in the uDMA software ISR.
+**********************************************************************/
+void UDMA_SetCallBack(UDMA_ChannelType Channel, UDMA_CallBackType CallBack_Ptr)
+{
+    if (Channel >= UDMA_CHANNELS_NUM)
+    {
+        /*WRONG CHANNEL DO NOTHING*/
+        return;
+    }
+
+    g_UDMA_CallBacks[Channel] = CallBack_Ptr;
+    if (CallBack_Ptr != NULL_PTR)
+    {
+        g_UDMA_CallBacksMask |= UDMA_CHANNEL_MASK(Channel);
+    }
+    else
+    {
+        g_UDMA_CallBacksMask &= ~UDMA_CHANNEL_MASK(Channel);
+    }
+}
+
+/*********************************************************************
+* Service Name: UDMA_MemCopy
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Src_Ptr - source buffer / Size - number of bytes / CallBack_Ptr - completion callback, may be NULL_PTR
+* Parameters (inout): None
+* Parameters (out): Dst_Ptr - destination buffer
+* Return value: boolean - FALSE if a copy is still running or Size is too big
+* Description: Function to start a memory to memory copy on UDMA_MEMCOPY_CHANNEL
+  and return at once. Word aligned buffers are copied a word at a time, copies
+  over UDMA_MAX_ITEMS items are chained with scatter-gather.
+**********************************************************************/
+boolean UDMA_MemCopy(void *Dst_Ptr, const void *Src_Ptr, uint32 Size, UDMA_CallBackType CallBack_Ptr)
+{
+    uint32 alignment = (uint32)Dst_Ptr | (uint32)Src_Ptr | Size;
+    uint32 size_log2;
+    uint32 control;
+    uint32 items;
+    uint32 task_items;
+    uint32 tasks_num;
+    uint32 task;
+
+    if (Dst_Ptr == NULL_PTR || Src_Ptr == NULL_PTR || Size == 0 || UDMA_IsChannelEnabled(UDMA_MEMCOPY_CHANNEL))
+    {
+        return FALSE;
+    }
+
+    /* Widest item size allowed by both addresses and the size */
+    size_log2 = (!(alignment & 3u)) ? UDMA_SIZE_32 : ((!(alignment & 1u)) ? UDMA_SIZE_16 : UDMA_SIZE_8);
+    items = Size >> size_log2;
+    tasks_num = (items + UDMA_MAX_ITEMS - 1) / UDMA_MAX_ITEMS;
+    if (tasks_num > UDMA_MEMCOPY_MAX_TASKS)
+    {
+        LOG_1(LOG_LEVEL_ERROR, "UDMA_MemCopy: %u bytes is too big", Size);
+        return FALSE;
+    }
+
+    control = UDMA_CONTROL(size_log2, size_log2, size_log2, UDMA_ARB_8);
+    UDMA_SetCallBack(UDMA_MEMCOPY_CHANNEL, CallBack_Ptr);
+    UDMA_SetChannelAttributes(UDMA_MEMCOPY_CHANNEL, FALSE, FALSE);
+
+    if (tasks_num == 1)
+    {
+        (void)UDMA_SetTransfer(UDMA_MEMCOPY_CHANNEL, FALSE, control, UDMA_MODE_AUTO,
+                               Src_Ptr, Dst_Ptr, (uint16)items);
+    }
+    else
+    {
+        for (task = 0; task < tasks_num; task++)
+        {
+            task_items = (items > UDMA_MAX_ITEMS) ? UDMA_MAX_ITEMS : items;
+            (void)UDMA_SetTask(&g_UDMA_MemCopyTasks[task], control,
+                               (task == tasks_num - 1) ? UDMA_MODE_AUTO : UDMA_MODE_MEM_SG_TASK,
+                               (const uint8 *)Src_Ptr + ((task * UDMA_MAX_ITEMS) << size_log2),
+                               (uint8 *)Dst_Ptr + ((task * UDMA_MAX_ITEMS) << size_log2),
+                               (uint16)task_items);
+            items -= task_items;
+        }
+        (void)UDMA_SetScatterGather(UDMA_MEMCOPY_CHANNEL, g_UDMA_MemCopyTasks, (uint8)tasks_num, FALSE);
+    }
+
+    UDMA_EnableChannel(UDMA_MEMCOPY_CHANNEL);
+    UDMA_RequestChannel(UDMA_MEMCOPY_CHANNEL);
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: UDMA_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bus errors since UDMA_Init()
+* Description: Function to read the uDMA bus error counter.
+**********************************************************************/
+uint32 UDMA_GetErrorCount(void)
+{
+    return g_UDMA_Errors;
+}
+
+#if (UDMA_BENCHMARK == TRUE)
+/*********************************************************************
+* Service Name: UDMA_Benchmark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - cycles of the CPU and of the uDMA copy
+* Return value: None
+* Description: Function to time a UDMA_BENCHMARK_SIZE bytes copy with memcpy()
+  and with UDMA_MemCopy(). It needs the interrupts enabled.
+**********************************************************************/
+void UDMA_Benchmark(UDMA_BenchmarkReportType *Report_Ptr)
+{
+    uint32 start;
+    uint32 index;
+
+    if (Report_Ptr == NULL_PTR)
+    {
+        /*WRONG REPORT POINTER DO NOTHING*/
+        return;
+    }
+
+    for (index = 0; index < UDMA_BENCHMARK_SIZE / sizeof(uint32); index++)
+    {
+        g_UDMA_BenchmarkSrc[index] = index * 0x9E3779B9u;
+    }
+
+    start = DWT_CYCCNT_REG;
+    (void)memcpy(g_UDMA_BenchmarkDst, g_UDMA_BenchmarkSrc, UDMA_BENCHMARK_SIZE);
+    Report_Ptr->Cpu_Cycles = DWT_CYCCNT_REG - start;
+
+    g_UDMA_BenchmarkDoneStamp = 0;
+    start = DWT_CYCCNT_REG;
+    if (!UDMA_MemCopy(g_UDMA_BenchmarkDst, g_UDMA_BenchmarkSrc, UDMA_BENCHMARK_SIZE, UDMA_BenchmarkDone))
+    {
+        return;
+    }
+    Report_Ptr->Setup_Cycles = DWT_CYCCNT_REG - start;
+
+    /* The CPU is free from here, it only waits for the callback */
+    while (g_UDMA_BenchmarkDoneStamp == 0);
+    Report_Ptr->Dma_Cycles = g_UDMA_BenchmarkDoneStamp - start;
+}
+#endif
@@ -0,0 +1,374 @@
+ /******************************************************************************
+ *
+ * Module: UDMA
+ *
+ * File Name: UDMA.h
+ *
+ * Description: Header file for the micro DMA controller driver. The channel
+ *              control table (primary and alternate structures of the 32
+ *              channels) lives in SRAM aligned to 1 KB. Basic, auto, ping-pong
+ *              and scatter-gather transfers are set up per channel, software
+ *              channel completions are dispatched to callbacks from the uDMA
+ *              software IRQ, peripheral channels complete on the peripheral IRQ
+ *
+ *******************************************************************************/
+
+#ifndef UDMA_H_
+#define UDMA_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+#define UDMA_CHANNELS_NUM                    32u
+
+/* Items moved by one control structure */
+#define UDMA_MAX_ITEMS                       1024u
+
+#define UDMA_SOFTWARE_IRQ_NUM                46u
+#define UDMA_ERROR_IRQ_NUM                   47u
+
+/* Dedicated software channel used by UDMA_MemCopy() */
+#define UDMA_MEMCOPY_CHANNEL                 30u
+
+/* Scatter-gather tasks of one UDMA_MemCopy(), UDMA_MAX_ITEMS items each */
+#define UDMA_MEMCOPY_MAX_TASKS               8u
+
+/* Items moved before the controller arbitrates again, as a power of two */
+#define UDMA_ARB_1                           0u
+#define UDMA_ARB_4                           2u
+#define UDMA_ARB_8                           3u
+#define UDMA_ARB_16                          4u
+#define UDMA_ARB_1024                        10u
+
+/* Transfer settings of a channel control word, without the size and the mode */
+#define UDMA_CONTROL(SIZE, SRC_INC, DST_INC, ARB)  (((uint32)(DST_INC) << 30) | ((uint32)(SIZE) << 28) | \
+                                                    ((uint32)(SRC_INC) << 26) | ((uint32)(SIZE) << 24) | \
+                                                    ((uint32)(ARB) << 14))
+
+/* Set to TRUE to run UDMA_Benchmark() from main() before the application starts */
+#ifndef UDMA_BENCHMARK
+#define UDMA_BENCHMARK                       FALSE
+#endif
+
+#define UDMA_BENCHMARK_SIZE                  4096u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+typedef uint8 UDMA_ChannelType;
+
+/* Item size, the same for source and destination */
+typedef enum
+{
+    UDMA_SIZE_8,
+    UDMA_SIZE_16,
+    UDMA_SIZE_32
+}UDMA_SizeType;
+
+typedef enum
+{
+    UDMA_INC_8,
+    UDMA_INC_16,
+    UDMA_INC_32,
+    UDMA_INC_NONE      /* fixed address, e.g. a peripheral data register */
+}UDMA_IncrementType;
+
+/* Values of the XFERMODE field */
+typedef enum
+{
+    UDMA_MODE_STOP,
+    UDMA_MODE_BASIC,                 /* one request moves ARB items, the channel waits for the next request */
+    UDMA_MODE_AUTO,                  /* one request moves all the items */
+    UDMA_MODE_PINGPONG,              /* primary and alternate take turns, each one is re-armed once it stops */
+    UDMA_MODE_MEM_SCATTER_GATHER,    /* primary only: copies the tasks to the alternate structure */
+    UDMA_MODE_MEM_SG_TASK,           /* task of a memory scatter-gather list, except the last one */
+    UDMA_MODE_PERIPH_SCATTER_GATHER,
+    UDMA_MODE_PERIPH_SG_TASK
+}UDMA_ModeType;
+
+typedef void (*UDMA_CallBackType)(UDMA_ChannelType Channel);
+
+#if (UDMA_BENCHMARK == TRUE)
+typedef struct
+{
+    uint32 Cpu_Cycles;      /* memcpy() of UDMA_BENCHMARK_SIZE bytes */
+    uint32 Setup_Cycles;    /* CPU time of UDMA_MemCopy() for the same copy */
+    uint32 Dma_Cycles;      /* from UDMA_MemCopy() to the completion callback */
+}UDMA_BenchmarkReportType;
+#endif
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: UDMA_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the uDMA controller with the channel control
+  table, all the channels disabled, and its software and error IRQs.
+**********************************************************************/
+void UDMA_Init(void);
+
+/*********************************************************************
+* Service Name: UDMA_AssignChannel
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Encoding - peripheral encoding of the channel (0 - 4)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the peripheral of a channel in its CHMAPn field.
+**********************************************************************/
+void UDMA_AssignChannel(UDMA_ChannelType Channel, uint8 Encoding);
+
+/*********************************************************************
+* Service Name: UDMA_SetChannelAttributes
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / High_Priority - arbitration priority / Burst_Only - ignore single requests
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the priority and burst settings of a channel,
+  unmask its requests and select its primary structure.
+**********************************************************************/
+void UDMA_SetChannelAttributes(UDMA_ChannelType Channel, boolean High_Priority, boolean Burst_Only);
+
+/*********************************************************************
+* Service Name: UDMA_SetTask
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Control - UDMA_CONTROL() settings / Mode - transfer mode / Src_Ptr - first source item /
+                   Dst_Ptr - first destination item / Items - number of items (1 - UDMA_MAX_ITEMS)
+* Parameters (inout): Entry_Ptr - control structure or scatter-gather task
+* Parameters (out): None
+* Return value: boolean - FALSE if the number of items is out of range
+* Description: Function to fill one control structure, the end pointers are
+  computed from the increments.
+**********************************************************************/
+boolean UDMA_SetTask(UDMA_ControlEntryType *Entry_Ptr, uint32 Control, UDMA_ModeType Mode,
+                     const volatile void *Src_Ptr, volatile void *Dst_Ptr, uint16 Items);
+
+/*********************************************************************
+* Service Name: UDMA_SetTransfer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure / Control - UDMA_CONTROL() settings /
+                   Mode - transfer mode / Src_Ptr - first source item / Dst_Ptr - first destination item / Items - number of items
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the channel or the number of items is out of range
+* Description: Function to fill the primary or the alternate structure of a channel.
+**********************************************************************/
+boolean UDMA_SetTransfer(UDMA_ChannelType Channel, boolean Alternate, uint32 Control, UDMA_ModeType Mode,
+                         const volatile void *Src_Ptr, volatile void *Dst_Ptr, uint16 Items);
+
+/*********************************************************************
+* Service Name: UDMA_SetScatterGather
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Tasks_Ptr - task list filled with UDMA_SetTask() / Tasks_Num - number of tasks /
+                   Peripheral - TRUE for a peripheral scatter-gather
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - FALSE if the channel or the number of tasks is out of range
+* Description: Function to make the primary structure copy the tasks one by one
+  to the alternate structure. Every task but the last uses the *_SG_TASK mode,
+  the last one AUTO (memory) or BASIC (peripheral). The list must stay valid
+  until the transfer ends.
+**********************************************************************/
+boolean UDMA_SetScatterGather(UDMA_ChannelType Channel, const UDMA_ControlEntryType *Tasks_Ptr, uint8 Tasks_Num,
+                              boolean Peripheral);
+
+/*********************************************************************
+* Service Name: UDMA_GetMode
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: UDMA_ModeType - current mode, UDMA_MODE_STOP once the structure is done
+* Description: Function to find which half of a ping-pong transfer completed.
+**********************************************************************/
+UDMA_ModeType UDMA_GetMode(UDMA_ChannelType Channel, boolean Alternate);
+
+/*********************************************************************
+* Service Name: UDMA_StopTransfer
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a structure to UDMA_MODE_STOP, so a ping-pong
+  transfer ends instead of switching to it.
+**********************************************************************/
+void UDMA_StopTransfer(UDMA_ChannelType Channel, boolean Alternate);
+
+/*********************************************************************
+* Service Name: UDMA_GetRemainingItems
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - items not transferred yet, 0 once the structure is done
+* Description: Function to read the progress of a structure, the controller
+  counts its transfer size down while it runs.
+**********************************************************************/
+uint16 UDMA_GetRemainingItems(UDMA_ChannelType Channel, boolean Alternate);
+
+/*********************************************************************
+* Service Name: UDMA_IsAlternateActive
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the channel uses its alternate structure
+* Description: Function to find the structure a ping-pong transfer is filling.
+**********************************************************************/
+boolean UDMA_IsAlternateActive(UDMA_ChannelType Channel);
+
+/*********************************************************************
+* Service Name: UDMA_SelectStructure
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number / Alternate - TRUE for the alternate structure
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to choose the structure a disabled channel starts with.
+**********************************************************************/
+void UDMA_SelectStructure(UDMA_ChannelType Channel, boolean Alternate);
+
+/*********************************************************************
+* Service Name: UDMA_AckCompletion
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the channel completed since the last call
+* Description: Function to clear the completion flag of a peripheral channel,
+  to be called from the peripheral ISR.
+**********************************************************************/
+boolean UDMA_AckCompletion(UDMA_ChannelType Channel);
+
+/*********************************************************************
+* Service Name: UDMA_EnableChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to let a channel start on the next request. The
+  controller disables it again at the end of the transfer.
+**********************************************************************/
+void UDMA_EnableChannel(UDMA_ChannelType Channel);
+
+/*********************************************************************
+* Service Name: UDMA_DisableChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a channel.
+**********************************************************************/
+void UDMA_DisableChannel(UDMA_ChannelType Channel);
+
+/*********************************************************************
+* Service Name: UDMA_IsChannelEnabled
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE while the channel transfer is not finished
+* Description: Function to poll a channel.
+**********************************************************************/
+boolean UDMA_IsChannelEnabled(UDMA_ChannelType Channel);
+
+/*********************************************************************
+* Service Name: UDMA_RequestChannel
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - channel number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to issue a software request on an enabled channel.
+**********************************************************************/
+void UDMA_RequestChannel(UDMA_ChannelType Channel);
+
+/*********************************************************************
+* Service Name: UDMA_SetCallBack
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Channel - channel number / CallBack_Ptr - function called at completion, NULL_PTR for none
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the completion callback of a software channel,
+  it runs in the uDMA software ISR.
+**********************************************************************/
+void UDMA_SetCallBack(UDMA_ChannelType Channel, UDMA_CallBackType CallBack_Ptr);
+
+/*********************************************************************
+* Service Name: UDMA_MemCopy
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Src_Ptr - source buffer / Size - number of bytes / CallBack_Ptr - completion callback, may be NULL_PTR
+* Parameters (inout): None
+* Parameters (out): Dst_Ptr - destination buffer
+* Return value: boolean - FALSE if a copy is still running or Size is too big
+* Description: Function to start a memory to memory copy on UDMA_MEMCOPY_CHANNEL
+  and return at once. Word aligned buffers are copied a word at a time, copies
+  over UDMA_MAX_ITEMS items are chained with scatter-gather.
+**********************************************************************/
+boolean UDMA_MemCopy(void *Dst_Ptr, const void *Src_Ptr, uint32 Size, UDMA_CallBackType CallBack_Ptr);
+
+/*********************************************************************
+* Service Name: UDMA_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - number of bus errors since UDMA_Init()
+* Description: Function to read the uDMA bus error counter.
+**********************************************************************/
+uint32 UDMA_GetErrorCount(void);
+
+#if (UDMA_BENCHMARK == TRUE)
+/*********************************************************************
+* Service Name: UDMA_Benchmark
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Report_Ptr - cycles of the CPU and of the uDMA copy
+* Return value: None
+* Description: Function to time a UDMA_BENCHMARK_SIZE bytes copy with memcpy()
+  and with UDMA_MemCopy(). It needs the interrupts enabled.
+**********************************************************************/
+void UDMA_Benchmark(UDMA_BenchmarkReportType *Report_Ptr);
+#endif
+
+#endif /* UDMA_H_ */
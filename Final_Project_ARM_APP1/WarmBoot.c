@@ -0,0 +1,155 @@
+ /******************************************************************************
+ *
+ * Module: WarmBoot
+ *
+ * File Name: WarmBoot.c
+ *
+ * Description: Source file for the warm boot support
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "WarmBoot.h"
+#include "Crc.h"
+#include "Log.h"
+#include "interruptsControl.h"
+#include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
+
+/*******************************************************************************
+ *                           Private Data Types                                *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 Magic;
+    WarmBoot_StateType State;
+    uint16 Crc;                  /* of Magic and State */
+}WarmBoot_BlockType;
+
+/*******************************************************************************
+ *                          Private Global Variables                           *
+ *******************************************************************************/
+/* Kept over the system reset, C initialization does not touch it */
+#pragma NOINIT(g_WarmBoot_Block)
+static WarmBoot_BlockType g_WarmBoot_Block;
+
+static uint32 g_WarmBoot_ResetCause = 0;
+static boolean g_WarmBoot_StateValid = FALSE;
+
+/*******************************************************************************
+ *                          Private Functions Definitions                      *
+ *******************************************************************************/
+
+static uint16 WarmBoot_BlockCrc(const WarmBoot_BlockType *Block_Ptr)
+{
+    uint16 crc = Crc_Crc16((const uint8 *)&Block_Ptr->Magic, sizeof(Block_Ptr->Magic), CRC16_INITIAL_VALUE);
+    return Crc_Crc16((const uint8 *)&Block_Ptr->State, sizeof(Block_Ptr->State), crc);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: WarmBoot_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if this is a warm boot with a valid saved state
+* Description: Function to latch and clear the reset cause and to check the
+  saved state block. The state is trusted only after a watchdog or software
+  reset, with a matching magic and CRC. It must be called once at startup,
+  before any other user of the reset cause.
+**********************************************************************/
+CODE_COLD boolean WarmBoot_Init(void)
+{
+    /* RESC bits are sticky, clear them so the next reset reports only its own cause */
+    g_WarmBoot_ResetCause = SYSCTL->RESC;
+    SYSCTL->RESC = 0;
+
+    g_WarmBoot_StateValid = (boolean)((g_WarmBoot_ResetCause & WARMBOOT_WARM_RESETS_MASK) &&
+                                      !(g_WarmBoot_ResetCause & (WARMBOOT_RESET_POWER_ON | WARMBOOT_RESET_BROWN_OUT)) &&
+                                      g_WarmBoot_Block.Magic == WARMBOOT_MAGIC &&
+                                      g_WarmBoot_Block.Crc == WarmBoot_BlockCrc(&g_WarmBoot_Block));
+
+    if (g_WarmBoot_StateValid)
+    {
+        LOG_1(LOG_LEVEL_INFO, "Warm boot, reset cause 0x%08x", g_WarmBoot_ResetCause);
+    }
+    else
+    {
+        LOG_1(LOG_LEVEL_INFO, "Cold boot, reset cause 0x%08x", g_WarmBoot_ResetCause);
+        g_WarmBoot_Block.Magic = 0;
+    }
+    return g_WarmBoot_StateValid;
+}
+
+/*********************************************************************
+* Service Name: WarmBoot_GetResetCause
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - WARMBOOT_RESET_xxx bits latched by WarmBoot_Init()
+* Description: Function to read the cause of the last reset.
+**********************************************************************/
+uint32 WarmBoot_GetResetCause(void)
+{
+    return g_WarmBoot_ResetCause;
+}
+
+/*********************************************************************
+* Service Name: WarmBoot_Restore
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): State_Ptr - the saved state
+* Return value: boolean - FALSE on a cold boot or if the saved state is not valid
+* Description: Function to read the state saved before the last reset.
+**********************************************************************/
+boolean WarmBoot_Restore(WarmBoot_StateType *State_Ptr)
+{
+    if (!g_WarmBoot_StateValid || State_Ptr == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    *State_Ptr = g_WarmBoot_Block.State;
+    return TRUE;
+}
+
+/*********************************************************************
+* Service Name: WarmBoot_Save
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): State_Ptr - the state to keep
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to update the state block and its CRC. It runs in a
+  critical section so no interrupt sees half of it, and a reset in the middle
+  leaves a wrong CRC.
+**********************************************************************/
+void WarmBoot_Save(const WarmBoot_StateType *State_Ptr)
+{
+    uint32 primask;
+
+    if (State_Ptr == NULL_PTR)
+    {
+        /*WRONG STATE POINTER DO NOTHING*/
+        return;
+    }
+
+    primask = Interrupts_DisableSave();
+    g_WarmBoot_Block.Magic = WARMBOOT_MAGIC;
+    g_WarmBoot_Block.State = *State_Ptr;
+    g_WarmBoot_Block.Crc = WarmBoot_BlockCrc(&g_WarmBoot_Block);
+    Interrupts_Restore(primask);
+}
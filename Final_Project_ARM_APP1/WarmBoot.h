@@ -0,0 +1,109 @@
+ /******************************************************************************
+ *
+ * Module: WarmBoot
+ *
+ * File Name: WarmBoot.h
+ *
+ * Description: Header file for the warm boot support. The reset cause is
+ *              latched at startup, and a CRC protected state block in no-init
+ *              RAM lets the application skip the slow initialization steps and
+ *              resume where it was after a watchdog or software reset
+ *
+ *******************************************************************************/
+
+#ifndef WARMBOOT_H_
+#define WARMBOOT_H_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include "std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+/* Reset causes, the bits of the SYSCTL RESC register */
+#define WARMBOOT_RESET_EXTERNAL              0x00000001u
+#define WARMBOOT_RESET_POWER_ON              0x00000002u
+#define WARMBOOT_RESET_BROWN_OUT             0x00000004u
+#define WARMBOOT_RESET_WATCHDOG0             0x00000008u
+#define WARMBOOT_RESET_SOFTWARE              0x00000010u
+#define WARMBOOT_RESET_WATCHDOG1             0x00000020u
+#define WARMBOOT_RESET_MOSC_FAILURE          0x00010000u
+
+/* Resets that keep the SRAM content */
+#define WARMBOOT_WARM_RESETS_MASK            (WARMBOOT_RESET_WATCHDOG0 | WARMBOOT_RESET_SOFTWARE | WARMBOOT_RESET_WATCHDOG1)
+
+/* Marks a saved state block, "WARM" */
+#define WARMBOOT_MAGIC                       0x4D524157u
+
+/*******************************************************************************
+ *                         Data Types Declarations                             *
+ *******************************************************************************/
+
+/* Application state kept over a warm reset */
+typedef struct
+{
+    uint32 Delay_Calibration;    /* Delay_GetCalibration() */
+    uint8 Led_Phase;             /* g_Counter of main.c */
+}WarmBoot_StateType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*********************************************************************
+* Service Name: WarmBoot_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if this is a warm boot with a valid saved state
+* Description: Function to latch and clear the reset cause and to check the
+  saved state block. The state is trusted only after a watchdog or software
+  reset, with a matching magic and CRC. It must be called once at startup,
+  before any other user of the reset cause.
+**********************************************************************/
+boolean WarmBoot_Init(void);
+
+/*********************************************************************
+* Service Name: WarmBoot_GetResetCause
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - WARMBOOT_RESET_xxx bits latched by WarmBoot_Init()
+* Description: Function to read the cause of the last reset.
+**********************************************************************/
+uint32 WarmBoot_GetResetCause(void);
+
+/*********************************************************************
+* Service Name: WarmBoot_Restore
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): State_Ptr - the saved state
+* Return value: boolean - FALSE on a cold boot or if the saved state is not valid
+* Description: Function to read the state saved before the last reset.
+**********************************************************************/
+boolean WarmBoot_Restore(WarmBoot_StateType *State_Ptr);
+
+/*********************************************************************
+* Service Name: WarmBoot_Save
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): State_Ptr - the state to keep
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to update the state block and its CRC. It runs in a
+  critical section so no interrupt sees half of it, and a reset in the middle
+  leaves a wrong CRC.
+**********************************************************************/
+void WarmBoot_Save(const WarmBoot_StateType *State_Ptr);
+
+#endif /* WARMBOOT_H_ */
@@ -0,0 +1,27 @@
+/*
+ * interruptsControl.c
+ *
+ * Nestable critical sections, kept in assembly so the PRIMASK access cannot be
+ * reordered by the compiler.
+ */
+
+#include "interruptsControl.h"
+
+__asm("    .sect \".text:Interrupts_DisableSave\"\n"
+      "    .clink\n"
+      "    .thumbfunc Interrupts_DisableSave\n"
+      "    .thumb\n"
+      "    .global Interrupts_DisableSave\n"
+      "Interrupts_DisableSave:\n"
+      "    mrs     r0, PRIMASK\n"
+      "    cpsid   i\n"
+      "    bx      lr\n");
+
+__asm("    .sect \".text:Interrupts_Restore\"\n"
+      "    .clink\n"
+      "    .thumbfunc Interrupts_Restore\n"
+      "    .thumb\n"
+      "    .global Interrupts_Restore\n"
+      "Interrupts_Restore:\n"
+      "    msr     PRIMASK, r0\n"
+      "    bx      lr\n");
@@ -8,6 +8,8 @@
 #ifndef INTERRUPTSCONTROL_H_
 #define INTERRUPTSCONTROL_H_
 
+#include "std_types.h"
+
 
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
@@ -24,5 +26,13 @@
 /* Go to low power mode while waiting for the next interrupt */
 #define Wait_For_Interrupt()   __asm(" WFI ")
 
+/* Save the PRIMASK and disable IRQ interrupts, Programmable Systems Exceptions and Faults.
+ * Unlike Disable_Exceptions() it can be nested, the returned value must be passed to
+ * Interrupts_Restore() at the end of the critical section. */
+uint32 Interrupts_DisableSave(void);
+
+/* Restore the PRIMASK saved by Interrupts_DisableSave() */
+void Interrupts_Restore(uint32 a_PriMask);
+
 
 #endif /* INTERRUPTSCONTROL_H_ */
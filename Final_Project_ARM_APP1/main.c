@@ -1,67 +1,210 @@
 #include "SysTick.h"
+#include "Delay.h"
 #include "NVIC.h"
+#include "RegInit.h"
+#include "Profiler.h"
+#include "IrqLatency.h"
+#include "PcSampler.h"
+#include "Trace.h"
+#include "Rtt.h"
+#include "StackMonitor.h"
+#include "MPU.h"
+#include "FaultCapture.h"
+#include "WarmBoot.h"
+#include "BootProfile.h"
+#include "RamFunc.h"
+#include "Log.h"
+#include "FPU.h"
+#include "UART.h"
+#include "UDMA.h"
+#include "Telemetry.h"
 #include "tm4c123gh6pm_registers.h"
+#include "CodeLayout.h"
 
 #define GPIO_PORTF_IRQ_NUM                30
 #define GPIO_PORTF_INTERRUPT_PRIORITY     2
 #define SYSTICK_INTERRUPT_PRIORITY        1
+#define UART0_INTERRUPT_PRIORITY          1
 
-#define NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND 364
+/* PORTF pin groups */
+#define PORTF_SW2_PIN_MASK                0x01        /* PF0 */
+#define PORTF_LEDS_PINS_MASK              0x0E        /* PF1, PF2 and PF3 */
+#define PORTF_USED_PINS_MASK              (PORTF_SW2_PIN_MASK | PORTF_LEDS_PINS_MASK)
+#define PORTF_USED_PINS_PCTL_MASK         0x0000FFFF  /* PMC0 - PMC3 */
+
+/* SW2 (PF0) storm protection: accept 4 edges per SysTick period (1 second),
+ * then mask PF0 for 2 periods */
+#define GPIO_PORTF_RATE_LIMIT_CHANNEL     0
+#define GPIO_PORTF_MAX_EDGES_PER_WINDOW   4
+#define GPIO_PORTF_WINDOW_TICKS           1
+#define GPIO_PORTF_HOLD_OFF_TICKS         2
+
+/* Event IDs of the TELEMETRY_RECORD_EVENT records */
+#define TELEMETRY_EVENT_SW2_PRESSED       1
+#define TELEMETRY_EVENT_SW2_DROPPED       2
+
+#if (IRQLATENCY_BENCHMARK == TRUE)
+/* Latency regression runs: no load, 200 cycles masked sections in thread mode and
+ * 200 cycles busy PORTF ISR preempted by SysTick. Budgets are in system clock cycles */
+#define IRQLATENCY_RUNS_NUM               3
+static const IrqLatency_ConfigType g_IrqLatency_Runs[IRQLATENCY_RUNS_NUM] =
+{
+    {IRQLATENCY_LOAD_NONE,   0,   100, 4, 64,  64},
+    {IRQLATENCY_LOAD_MASKED, 200, 100, 4, 256, 256},
+    {IRQLATENCY_LOAD_NESTED, 200, 100, 4, 64,  64}
+};
+#endif
+
+#if (LAYOUT_BENCHMARK == TRUE) && (PROFILER_ENABLE != TRUE)
+#error "LAYOUT_BENCHMARK needs PROFILER_ENABLE"
+#endif
+
+/* Benchmark reports: every X_BENCHMARK switch set to TRUE runs its benchmark once
+ * in Benchmarks_Run(), which logs a summary on RTT. The full report is kept here
+ * for the debugger */
+#if (RAMFUNC_BENCHMARK == TRUE)
+static RamFunc_BenchmarkReportType g_RamFunc_Report;
+#endif
+#if (UDMA_BENCHMARK == TRUE)
+static UDMA_BenchmarkReportType g_UDMA_Report;
+#endif
+#if (FPU_BENCHMARK == TRUE)
+static FPU_BenchmarkReportType g_FPU_Report;
+#endif
+#if (IRQLATENCY_BENCHMARK == TRUE)
+static IrqLatency_ReportType g_IrqLatency_Reports[IRQLATENCY_RUNS_NUM];
+#endif
+#if (LAYOUT_BENCHMARK == TRUE)
+static Profiler_StatsType g_Layout_Report;
+#endif
+
+/* Bottom of the main stack, defined by the linker */
+extern uint32 __stack;
 
 /* Global variable to count time in seconds */
 volatile uint8 g_Counter = 0;
 
-void Delay_MS(unsigned long long n)
+/* State resumed after a watchdog or software reset */
+static WarmBoot_StateType g_WarmBoot_State;
+
+/* Telemetry link on the virtual COM port of the debug interface */
+static const UART_ConfigType g_UART0_Config =
+{
+    115200
+};
+
+/* Binary records on the UART0 link, or kept in SRAM when the link is down */
+static const Telemetry_ConfigType g_Telemetry_Uart0Config =
 {
-    volatile uint64 count = 0;
-    while(count++ < (NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND * n) );
+    TELEMETRY_SINK_UART0
+};
+static const Telemetry_ConfigType g_Telemetry_MemoryConfig =
+{
+    TELEMETRY_SINK_MEMORY
+};
+
+#if (TELEMETRY_ISR_RECORDS == TRUE)
+/* Event record of the PORTF ISR: the event ID is the rate limiter verdict, the
+ * value the cycle counter when the ISR decided it */
+static RAMFUNC void PortF_SendEvent(uint32 Event_Id)
+{
+    uint32 event[2];
+
+    event[0] = Event_Id;
+    event[1] = DWT_CYCCNT_REG;
+    (void)Telemetry_Send(TELEMETRY_RECORD_EVENT, event, sizeof(event));
 }
+#endif
+
+/* Rate limiter configuration of the SW2 (PF0) external interrupt */
+static const NVIC_RateLimitConfigType g_PortF_RateLimitConfig =
+{
+    GPIO_PORTF_IRQ_NUM,
+    &GPIO_PORTF_IM_REG,
+    &GPIO_PORTF_ICR_REG,
+    PORTF_SW2_PIN_MASK,
+    GPIO_PORTF_MAX_EDGES_PER_WINDOW,
+    GPIO_PORTF_WINDOW_TICKS,
+    GPIO_PORTF_HOLD_OFF_TICKS
+};
 
 /* GPIO PORTF External Interrupt - ISR */
-void GPIOPortF_Handler(void)
+RAMFUNC void GPIOPortF_Handler(void)
 {
+    /* Software triggered by the latency benchmark, there is no PF0 edge to handle */
+    if (IRQLATENCY_PORTF_ENTRY() && !(GPIO_PORTF_RIS_REG & PORTF_SW2_PIN_MASK))
+    {
+        return;
+    }
+
+    TRACE_ISR_ENTER(TRACE_EXCEPTION_IRQ(GPIO_PORTF_IRQ_NUM));
+    FPU_NOFPU_ISR_ENTER();
+
+    /* Drop the edge if PF0 fires faster than the rate limiter allows */
+    if (!NVIC_RateLimitEvent(GPIO_PORTF_RATE_LIMIT_CHANNEL))
+    {
+#if (TELEMETRY_ISR_RECORDS == TRUE)
+        PortF_SendEvent(TELEMETRY_EVENT_SW2_DROPPED);
+#endif
+        GPIO_PORTF_ICR_REG   |= (1<<0);   /* Clear Trigger flag for PF0 (Interrupt Flag) */
+        FPU_NOFPU_ISR_EXIT(TRACE_EXCEPTION_IRQ(GPIO_PORTF_IRQ_NUM));
+        TRACE_ISR_EXIT(TRACE_EXCEPTION_IRQ(GPIO_PORTF_IRQ_NUM));
+        return;
+    }
+
+#if (TELEMETRY_ISR_RECORDS == TRUE)
+    PortF_SendEvent(TELEMETRY_EVENT_SW2_PRESSED);
+#endif
     SysTick_Stop();
     GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x0E; /* Turn on the Red, Blue and Green LEDs */
     Delay_MS(5000);
     SysTick_Start();
     GPIO_PORTF_ICR_REG   |= (1<<0);       /* Clear Trigger flag for PF0 (Interrupt Flag) */
+    FPU_NOFPU_ISR_EXIT(TRACE_EXCEPTION_IRQ(GPIO_PORTF_IRQ_NUM));
+    TRACE_ISR_EXIT(TRACE_EXCEPTION_IRQ(GPIO_PORTF_IRQ_NUM));
 }
 
-/* Enable PF0 (SW2) and activate external interrupt with falling edge */
-void SW2_Init(void)
+/* PORTF bring-up sequence: SW2 (PF0) as a falling edge interrupt input with pull-up and
+ * the RED, Blue and Green LEDs (PF1, PF2 and PF3) as outputs.
+ * Each register is written once with the merged masks of both pin groups. */
+static const RegInit_StepType g_PortF_InitSequence[] =
 {
-    GPIO_PORTF_LOCK_REG   = 0x4C4F434B;   /* Unlock the GPIO_PORTF_CR_REG */
-    GPIO_PORTF_CR_REG    |= (1<<0);       /* Enable changes on PF0 */
-    GPIO_PORTF_AMSEL_REG &= ~(1<<0);      /* Disable Analog on PF0 */
-    GPIO_PORTF_PCTL_REG  &= 0xFFFFFFF0;   /* Clear PMCx bits for PF0 to use it as GPIO pin */
-    GPIO_PORTF_DIR_REG   &= ~(1<<0);      /* Configure PF0 as input pin */
-    GPIO_PORTF_AFSEL_REG &= ~(1<<0);      /* Disable alternative function on PF0 */
-    GPIO_PORTF_PUR_REG   |= (1<<0);       /* Enable pull-up on PF0 */
-    GPIO_PORTF_DEN_REG   |= (1<<0);       /* Enable Digital I/O on PF0 */
-    GPIO_PORTF_IS_REG    &= ~(1<<0);      /* PF0 detect edges */
-    GPIO_PORTF_IBE_REG   &= ~(1<<0);      /* PF0 will detect a certain edge */
-    GPIO_PORTF_IEV_REG   &= ~(1<<0);      /* PF0 will detect a falling edge */
-    GPIO_PORTF_ICR_REG   |= (1<<0);       /* Clear Trigger flag for PF0 (Interrupt Flag) */
-    GPIO_PORTF_IM_REG    |= (1<<0);       /* Enable Interrupt on PF0 pin */
+    REGINIT_MODIFY(SYSCTL_RCGCGPIO_REG, 0, 0x20),                          /* Enable clock for PORTF */
+    REGINIT_WAIT_SET(SYSCTL_PRGPIO_REG, 0x20),                             /* Wait for clock to start */
+    REGINIT_WRITE(GPIO_PORTF_LOCK_REG, 0x4C4F434B),                        /* Unlock the GPIO_PORTF_CR_REG */
+    REGINIT_MODIFY(GPIO_PORTF_CR_REG, 0, PORTF_SW2_PIN_MASK),              /* Enable changes on PF0 */
+    REGINIT_MODIFY(GPIO_PORTF_AMSEL_REG, PORTF_USED_PINS_MASK, 0),         /* Disable Analog on PF0 - PF3 */
+    REGINIT_MODIFY(GPIO_PORTF_PCTL_REG, PORTF_USED_PINS_PCTL_MASK, 0),     /* Clear PMCx bits for PF0 - PF3 to use them as GPIO pins */
+    REGINIT_MODIFY(GPIO_PORTF_DIR_REG, PORTF_SW2_PIN_MASK, PORTF_LEDS_PINS_MASK), /* PF0 as input pin, PF1, PF2 and PF3 as output pins */
+    REGINIT_MODIFY(GPIO_PORTF_AFSEL_REG, PORTF_USED_PINS_MASK, 0),         /* Disable alternative function on PF0 - PF3 */
+    REGINIT_MODIFY(GPIO_PORTF_PUR_REG, 0, PORTF_SW2_PIN_MASK),             /* Enable pull-up on PF0 */
+    REGINIT_MODIFY(GPIO_PORTF_DEN_REG, 0, PORTF_USED_PINS_MASK),           /* Enable Digital I/O on PF0 - PF3 */
+    REGINIT_MODIFY(GPIO_PORTF_DATA_REG, PORTF_LEDS_PINS_MASK, 0),          /* Turn off the leds */
+    REGINIT_MODIFY(GPIO_PORTF_IS_REG, PORTF_SW2_PIN_MASK, 0),              /* PF0 detect edges */
+    REGINIT_MODIFY(GPIO_PORTF_IBE_REG, PORTF_SW2_PIN_MASK, 0),             /* PF0 will detect a certain edge */
+    REGINIT_MODIFY(GPIO_PORTF_IEV_REG, PORTF_SW2_PIN_MASK, 0),             /* PF0 will detect a falling edge */
+    REGINIT_WRITE(GPIO_PORTF_ICR_REG, PORTF_SW2_PIN_MASK),                 /* Clear Trigger flag for PF0 (Interrupt Flag) */
+    REGINIT_MODIFY(GPIO_PORTF_IM_REG, 0, PORTF_SW2_PIN_MASK),              /* Enable Interrupt on PF0 pin */
+};
+
+/* Enable PF0 (SW2) with falling edge external interrupt and PF1, PF2 and PF3 (RED, Blue and Green LEDs) */
+CODE_COLD void PortF_Init(void)
+{
+    RegInit_Execute(g_PortF_InitSequence, REGINIT_STEPS_NUM(g_PortF_InitSequence));
+
+    /* Guard PF0 against interrupt storms before enabling its IRQ */
+    NVIC_RateLimitInit(GPIO_PORTF_RATE_LIMIT_CHANNEL, &g_PortF_RateLimitConfig);
 
     /* Enable NVIC GPIO PORTF IRQ and set its priority */
     NVIC_EnableIRQ(GPIO_PORTF_IRQ_NUM);
     NVIC_SetPriorityIRQ(GPIO_PORTF_IRQ_NUM,GPIO_PORTF_INTERRUPT_PRIORITY);
 }
 
-/* Enable PF1, PF2 and PF3 (RED, Blue and Green LEDs) */
-void Leds_Init(void)
+RAMFUNC void SysTick_CallBackFunc(void)
 {
-    GPIO_PORTF_AMSEL_REG &= 0xF1;         /* Disable Analog on PF1, PF2 and PF3 */
-    GPIO_PORTF_PCTL_REG  &= 0xFFFF000F;   /* Clear PMCx bits for PF1, PF2 and PF3 to use it as GPIO pin */
-    GPIO_PORTF_DIR_REG   |= 0x0E;         /* Configure PF1, PF2 and PF3 as output pin */
-    GPIO_PORTF_AFSEL_REG &= 0xF1;         /* Disable alternative function on PF1, PF2 and PF3 */
-    GPIO_PORTF_DEN_REG   |= 0x0E;         /* Enable Digital I/O on PF1, PF2 and PF3 */
-    GPIO_PORTF_DATA_REG  &= 0xF1;         /* Clear bit 0, 1 and 2 in Data register to turn off the leds */
-}
+    /* Restart the rate limiter windows and re-arm the tripped IRQs */
+    NVIC_RateLimitTick();
 
-void SysTick_CallBackFunc(void)
-{
     g_Counter++;
 
     switch(g_Counter)
@@ -77,31 +220,192 @@ void SysTick_CallBackFunc(void)
         g_Counter = 0;
         break;
     }
+
+    /* Resume the LED sequence from here after a warm reset */
+    g_WarmBoot_State.Led_Phase = g_Counter;
+    WarmBoot_Save(&g_WarmBoot_State);
+
+#if (TELEMETRY_ISR_RECORDS == TRUE)
+    {
+        /* SysTick handler timing, encoded field by field into the frame */
+        Telemetry_FrameType frame;
+        Profiler_StatsType stats;
+        uint8 probe = PROFILER_PROBE_SYSTICK_HANDLER;
+
+        if (Profiler_GetStats(PROFILER_PROBE_SYSTICK_HANDLER, &stats) &&
+            Telemetry_Begin(&frame, TELEMETRY_RECORD_PROFILE, sizeof(probe) + sizeof(stats)))
+        {
+            Telemetry_Put(&frame, &probe, sizeof(probe));
+            Telemetry_Put(&frame, &stats, sizeof(stats));
+            (void)Telemetry_End(&frame);
+        }
+    }
+#endif
+}
+
+/* Run the benchmarks enabled by their X_BENCHMARK switch one after the other and
+ * log their reports. Needs the interrupts enabled and the SysTick running */
+static CODE_COLD void Benchmarks_Run(void)
+{
+#if (RAMFUNC_BENCHMARK == TRUE)
+    RamFunc_Benchmark(&g_RamFunc_Report);
+    LOG_2(LOG_LEVEL_INFO, "RAMFUNC kernel: %u cycles from flash, %u cycles from SRAM",
+          g_RamFunc_Report.Flash_Cycles, g_RamFunc_Report.Sram_Cycles);
+#endif
+
+#if (UDMA_BENCHMARK == TRUE)
+    UDMA_Benchmark(&g_UDMA_Report);
+    LOG_4(LOG_LEVEL_INFO, "%u bytes copy: memcpy %u cycles, uDMA %u cycles of which %u on the CPU",
+          UDMA_BENCHMARK_SIZE, g_UDMA_Report.Cpu_Cycles, g_UDMA_Report.Dma_Cycles, g_UDMA_Report.Setup_Cycles);
+#endif
+
+#if (FPU_BENCHMARK == TRUE)
+    FPU_Benchmark(&g_FPU_Report);
+    LOG_2(LOG_LEVEL_INFO, "PORTF entry without FPU context: %u-%u cycles",
+          g_FPU_Report.No_Context.Min_Cycles, g_FPU_Report.No_Context.Max_Cycles);
+    LOG_4(LOG_LEVEL_INFO, "PORTF entry with FPU context: lazy %u-%u cycles, always %u-%u cycles",
+          g_FPU_Report.Lazy.Min_Cycles, g_FPU_Report.Lazy.Max_Cycles,
+          g_FPU_Report.Always.Min_Cycles, g_FPU_Report.Always.Max_Cycles);
+#endif
+
+#if (IRQLATENCY_BENCHMARK == TRUE)
+    {
+        uint8 run;
+        for (run = 0; run < IRQLATENCY_RUNS_NUM; run++)
+        {
+            IrqLatency_Run(&g_IrqLatency_Runs[run], &g_IrqLatency_Reports[run]);
+            LOG_4(LOG_LEVEL_INFO, "IRQ latency run %u: SysTick %u cycles, PORTF %u cycles, passed %u",
+                  run, g_IrqLatency_Reports[run].SysTick_Worst_Latency,
+                  g_IrqLatency_Reports[run].PortF_Worst_Latency, g_IrqLatency_Reports[run].Passed);
+        }
+    }
+#endif
+
+#if (LAYOUT_BENCHMARK == TRUE)
+    {
+        /* Only the steady state ticks, without the ones taken during the initialization */
+        uint32 primask = Interrupts_DisableSave();
+        Profiler_Reset(PROFILER_PROBE_SYSTICK_HANDLER);
+        Interrupts_Restore(primask);
+        while (!Profiler_GetStats(PROFILER_PROBE_SYSTICK_HANDLER, &g_Layout_Report) ||
+               g_Layout_Report.Count < LAYOUT_BENCHMARK_TICKS);
+        LOG_3(LOG_LEVEL_INFO, "SysTick ISR path: min %u mean %u max %u cycles",
+              g_Layout_Report.Min_Cycles, g_Layout_Report.Mean_Cycles, g_Layout_Report.Max_Cycles);
+    }
+#endif
 }
 
 int main(void)
 {
-    /* Enable clock for PORTF and wait for clock to start */
-    SYSCTL_RCGCGPIO_REG |= 0x20;
-    while(!(SYSCTL_PRGPIO_REG & 0x20));
+    uint32 *msp_guard_top_ptr;
+    boolean warm_boot;
+
+    BootProfile_Mark(BOOTPROFILE_POINT_MAIN_ENTRY);
+
+    /* _c_int00 only grants the FPU access, interrupts taken over float code stack its context lazily */
+    FPU_Init();
+
+    /* Paint the unused main stack before anything else runs deeper on it */
+    StackMonitor_Init();
+
+    /* Reset the cycle counter probes before the drivers so they time the whole initialization */
+    Profiler_Init();
+
+    /* Record ISR, callback and NVIC events from here on, timestamped by the cycle counter */
+    Trace_Init();
+
+    /* Debugger readable log channels, the probe reads them while the core runs */
+    Rtt_Init();
+    Rtt_WriteString(RTT_CHANNEL_TERMINAL, "APP1 started\r\n");
+
+    BootProfile_Mark(BOOTPROFILE_POINT_DEBUG_READY);
+
+    /* Latch the reset cause, after a watchdog or software reset the SRAM state is still valid */
+    warm_boot = WarmBoot_Init();
+
+    /* Report the fault that caused the last reset, if any */
+    FaultCapture_Init();
+    BootProfile_Mark(BOOTPROFILE_POINT_RESET_CAUSE_CHECKED);
+
+    /* Flash read-only, SRAM never executable and a no-access guard at the bottom of the
+     * main stack, so an overflow faults on its first access to the guard. Only the RAMFUNC
+     * code is executable in SRAM */
+    MPU_Init();
+    if (!MPU_AddSramCodeRegion(RamFunc_GetRunAddress(), RamFunc_GetSize()))
+    {
+        /* The RAMFUNC ISRs would fault on their first fetch from the never executable SRAM */
+        LOG_0(LOG_LEVEL_ERROR, "RAMFUNC code not executable, MPU disabled");
+        MPU_Disable();
+    }
+    msp_guard_top_ptr = MPU_AddStackGuard(&__stack);
+    if (msp_guard_top_ptr != NULL_PTR)
+    {
+        StackMonitor_SetLowerLimit(STACKMONITOR_MSP_ID, msp_guard_top_ptr);
+    }
+    BootProfile_Mark(BOOTPROFILE_POINT_MPU_READY);
+
+    /* Enable clock for PORTF, initialize the SW2(PF0) as GPIO Pin and activate external interrupt
+     * with falling edge, and initialize the LEDs as GPIO Pins */
+    PortF_Init();
+    BootProfile_Mark(BOOTPROFILE_POINT_PORTF_READY);
+
+    /* Channel control table and the software / error IRQs, before the drivers that use channels */
+    UDMA_Init();
+
+    /* UART0 above the PORTF ISR: its FIFOs overflow long before SW2 handling ends */
+    if (UART_Init(&g_UART0_Config))
+    {
+        NVIC_SetPriorityIRQ(UART0_IRQ_NUM, UART0_INTERRUPT_PRIORITY);
+        Telemetry_Init(&g_Telemetry_Uart0Config);
+    }
+    else
+    {
+        Telemetry_Init(&g_Telemetry_MemoryConfig);
+    }
 
-    /* Initialize the SW2(PF0) as GPIO Pin and activate external interrupt with falling edge */
-    SW2_Init();
+    if (warm_boot && WarmBoot_Restore(&g_WarmBoot_State))
+    {
+        /* Same clock settings as before the reset: reuse the delay calibration and
+         * continue the LED sequence where it stopped */
+        Delay_SetCalibration(g_WarmBoot_State.Delay_Calibration);
+        g_Counter = g_WarmBoot_State.Led_Phase;
+    }
+    else
+    {
+        /* Calibrate the busy-wait delay against SysTick before the timer is taken by SysTick_Init() */
+        Delay_Init();
+        g_WarmBoot_State.Delay_Calibration = Delay_GetCalibration();
+        g_WarmBoot_State.Led_Phase = g_Counter;
+        WarmBoot_Save(&g_WarmBoot_State);
+    }
+    BootProfile_Mark(BOOTPROFILE_POINT_DELAY_READY);
 
-    /* Initialize the LEDs as GPIO Pins */
-    Leds_Init();
+#if (PCSAMPLER_ENABLE == TRUE)
+    /* Count the interrupted PC on every SysTick */
+    PcSampler_Init();
+    PcSampler_Start();
+#endif
 
     /* Start SysTick Timer to generate interrupt every 1 second */
     SysTick_Init(1000);
     NVIC_SetPriorityException(EXCEPTION_SYSTICK_TYPE,SYSTICK_INTERRUPT_PRIORITY);
     SysTick_SetCallBack(SysTick_CallBackFunc);
+    BootProfile_Mark(BOOTPROFILE_POINT_SYSTICK_READY);
 
     /* Enable Interrupts, Exceptions and Faults */
     Enable_Exceptions();
     Enable_Faults();
+    BootProfile_Mark(BOOTPROFILE_POINT_STEADY_STATE);
+
+    /* Boot timeline on the RTT terminal */
+    BootProfile_Dump();
+
+    /* Only with the X_BENCHMARK switches, in the steady state */
+    Benchmarks_Run();
 
     while(1)
     {
-
+        /* Idle: look for the stack high-water marks a small chunk at a time */
+        StackMonitor_Poll();
     }
 }
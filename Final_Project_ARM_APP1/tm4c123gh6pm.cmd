@@ -8,10 +8,32 @@
 
 --retain=g_pfnVectors
 
+/* Same switch as RamFunc.h: link with --define=RAMFUNC_ENABLE=FALSE when the */
+/* sources are built with it, the SRAM then keeps the 4 KB of SRAM_CODE.      */
+#ifndef TRUE
+#define TRUE    1
+#define FALSE   0
+#endif
+#ifndef RAMFUNC_ENABLE
+#define RAMFUNC_ENABLE  TRUE
+#endif
+
 MEMORY
 {
     FLASH (RX) : origin = 0x00000000, length = 0x00040000
+#if (RAMFUNC_ENABLE == TRUE)
+    SRAM (RWX) : origin = 0x20000000, length = 0x00007000
+
+    /* RAMFUNC code, the last 4 KB of the SRAM: aligned for one MPU region of up */
+    /* to 4 KB, and the link fails if .ramfunc outgrows it.                     */
+    SRAM_CODE (RWX) : origin = 0x20007000, length = 0x00001000
+#else
     SRAM (RWX) : origin = 0x20000000, length = 0x00008000
+#endif
+
+    /* Address space of the log format strings, never loaded to the target.  */
+    /* The low 24 bits of a string address are its log ID (see Log.h).      */
+    LOGSTR (R) : origin = 0xF0000000, length = 0x01000000
 }
 
 /* The following command line options are set as part of the CCS project.    */
@@ -29,17 +51,61 @@ MEMORY
 SECTIONS
 {
     .intvecs:   > 0x00000000
-    .text   :   > FLASH
+    /* Hot code first and together: the ISR paths share flash lines and prefetch  */
+    /* buffer hits. Build with LAYOUT_PROFILE=1 to put the functions listed in    */
+    /* layout_profile.cmd (made by tools/layout_profile.py from a PcSampler       */
+    /* histogram) in front, ordered by their sampled share of the run time. The   */
+    /* sources have to be built with it too, see CodeLayout.h.                    */
+    .text   :
+    {
+#if defined(LAYOUT_PROFILE) && (LAYOUT_PROFILE == 1)
+#include "layout_profile.cmd"
+#endif
+        *(.text:hot)
+        *(.text:Interrupts_DisableSave)
+        *(.text:Interrupts_Restore)
+        *(.text)
+    } > FLASH
+
+    /* CODE_COLD initialization and fault code, out of the way at the flash end  */
+    .text_cold : { *(.text:cold) } > FLASH(HIGH)
     .const  :   > FLASH
     .cinit  :   > FLASH
     .pinit  :   > FLASH
     .init_array : > FLASH
+    .binit  :   > FLASH
+
+    /* RAMFUNC code (see RamFunc.h): loaded in the flash, copied to SRAM by the    */
+    /* .binit copy table of _c_int00 or by Startup_Lean(). Padded to 512 bytes,    */
+    /* an eighth of the largest MPU region, so MPU_AddSramCodeRegion() can enable  */
+    /* exactly the subregions that hold code.                                      */
+#if (RAMFUNC_ENABLE == TRUE)
+    .ramfunc :  load = FLASH, run = SRAM_CODE, palign(0x200), table(BINIT),
+                LOAD_START(__ramfunc_load_start), RUN_START(__ramfunc_run_start), SIZE(__ramfunc_size)
+#else
+    /* Empty, kept for the symbols read by RamFunc.c and Startup.c */
+    .ramfunc :  load = FLASH, run = SRAM, table(BINIT),
+                LOAD_START(__ramfunc_load_start), RUN_START(__ramfunc_run_start), SIZE(__ramfunc_size)
+#endif
 
     .vtable :   > 0x20000000
+#if defined(STARTUP_LEAN) && (STARTUP_LEAN == 1)
+    /* Initialized by Startup_Lean() instead of the .cinit tables of _c_int00, */
+    /* padded to whole words for its copy and zero loops (see Startup.c).      */
+    .data   :   load = FLASH, run = SRAM, palign(4),
+                LOAD_START(__data_load_start), RUN_START(__data_run_start), SIZE(__data_size)
+    .bss    :   > SRAM, palign(4), RUN_START(__bss_start), RUN_END(__bss_end)
+#else
     .data   :   > SRAM
     .bss    :   > SRAM
+#endif
     .sysmem :   > SRAM
     .stack  :   > SRAM
+
+    /* Variables kept over a system reset (#pragma NOINIT), e.g. the fault record */
+    .TI.noinit : > SRAM, type = NOINIT
+
+    .logstr :   > LOGSTR, type = COPY
 }
 
 __STACK_TOP = __stack + 512;
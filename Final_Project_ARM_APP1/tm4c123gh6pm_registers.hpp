@@ -0,0 +1,661 @@
+ /******************************************************************************
+ *
+ * Module: Registers - C++ access layer
+ *
+ * File Name: tm4c123gh6pm_registers.hpp
+ *
+ * Description: Header-only C++11 layer over tm4c123gh6pm_registers.h with
+ *              compile-time register fields. Multiple field updates of one
+ *              register are folded into a single load/store at compile time,
+ *              and field values that do not fit are rejected by the compiler.
+ *
+ *              Covers every register of the GPIO, UART, uDMA, SysTick, NVIC and
+ *              SYSCTL structures of tm4c123gh6pm_registers.h, and the MPU, FPU,
+ *              DWT and DEMCR registers. Named fields are defined only for the
+ *              registers the drivers configure; other fields use Field<> directly.
+ *
+ *              Example: SysTick priority 1 and GPIO PORTF IRQ enabled
+ *                  tm4c::SysPri3::modify< tm4c::SysPri3::TICK::Value<1> >();
+ *                  tm4c::Nvic::enableIrq<30>();
+ *
+ *******************************************************************************/
+
+#ifndef TM4C123GH6PM_REGISTERS_HPP_
+#define TM4C123GH6PM_REGISTERS_HPP_
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+#include <stddef.h>
+
+extern "C"
+{
+#include "std_types.h"
+#include "tm4c123gh6pm_registers.h"
+#include "NVIC.h"
+}
+
+namespace tm4c
+{
+
+typedef uint32 Address;
+
+/*******************************************************************************
+ *                          Compile-time helpers                               *
+ *******************************************************************************/
+namespace detail
+{
+    /* Merge the masks and the values of field values that belong to register REG */
+    template <typename REG, typename... VALUES> struct Combine;
+
+    template <typename REG> struct Combine<REG>
+    {
+        static const uint32 mask = 0;
+        static const uint32 bits = 0;
+    };
+
+    template <typename REG, typename VALUE, typename... REST> struct Combine<REG, VALUE, REST...>
+    {
+        static_assert(VALUE::Register::address == REG::address, "field does not belong to this register");
+        static_assert((VALUE::mask & Combine<REG, REST...>::mask) == 0, "the same field is written twice");
+        static const uint32 mask = VALUE::mask | Combine<REG, REST...>::mask;
+        static const uint32 bits = VALUE::bits | Combine<REG, REST...>::bits;
+    };
+}
+
+/*******************************************************************************
+ *                           Register and Field                                *
+ *******************************************************************************/
+
+/* 32-bit memory mapped register at a fixed address */
+template <Address ADDR>
+struct Reg
+{
+    static const Address address = ADDR;
+
+    static volatile uint32 &ref() { return *reinterpret_cast<volatile uint32 *>(ADDR); }
+
+    static uint32 read() { return ref(); }
+
+    static void write(uint32 value) { ref() = value; }
+
+    /* One store of the given field values, all the other bits are written as 0 */
+    template <typename... VALUES>
+    static void write()
+    {
+        ref() = detail::Combine<Reg, VALUES...>::bits;
+    }
+
+    /* One load and one store: the given fields are updated, the other bits are kept */
+    template <typename... VALUES>
+    static void modify()
+    {
+        typedef detail::Combine<Reg, VALUES...> Fields;
+        ref() = (ref() & ~Fields::mask) | Fields::bits;
+    }
+};
+
+/* Bit field of WIDTH bits at bit position POS of register REG */
+template <typename REG, unsigned POS, unsigned WIDTH>
+struct Field
+{
+    static_assert(WIDTH > 0 && (POS + WIDTH) <= 32, "field does not fit in a 32-bit register");
+
+    typedef REG Register;
+    static const unsigned position = POS;
+    static const uint32 max = 0xFFFFFFFFu >> (32 - WIDTH);
+    static const uint32 mask = max << POS;
+
+    /* A compile-time value of this field, used as argument of Reg::write<>() and Reg::modify<>() */
+    template <uint32 VALUE>
+    struct Value
+    {
+        static_assert(VALUE <= max, "value does not fit in the field");
+        typedef REG Register;
+        static const uint32 mask = Field::mask;
+        static const uint32 bits = VALUE << POS;
+    };
+
+    static uint32 read() { return (REG::read() & mask) >> POS; }
+
+    template <uint32 VALUE>
+    static void write() { REG::template modify< Value<VALUE> >(); }
+};
+
+/* Single bit field */
+template <typename REG, unsigned BIT>
+struct Bit : Field<REG, BIT, 1>
+{
+    typedef typename Field<REG, BIT, 1>::template Value<1> Set;
+    typedef typename Field<REG, BIT, 1>::template Value<0> Clear;
+};
+
+/*******************************************************************************
+ *                              GPIO Ports                                     *
+ *******************************************************************************/
+template <Address BASE>
+struct GpioPort
+{
+    typedef Reg<BASE + offsetof(GPIO_RegType, DATA)>   DATA;
+    typedef Reg<BASE + offsetof(GPIO_RegType, DIR)>    DIR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, IS)>     IS;
+    typedef Reg<BASE + offsetof(GPIO_RegType, IBE)>    IBE;
+    typedef Reg<BASE + offsetof(GPIO_RegType, IEV)>    IEV;
+    typedef Reg<BASE + offsetof(GPIO_RegType, IM)>     IM;
+    typedef Reg<BASE + offsetof(GPIO_RegType, RIS)>    RIS;
+    typedef Reg<BASE + offsetof(GPIO_RegType, MIS)>    MIS;
+    typedef Reg<BASE + offsetof(GPIO_RegType, ICR)>    ICR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, AFSEL)>  AFSEL;
+    typedef Reg<BASE + offsetof(GPIO_RegType, DR2R)>   DR2R;
+    typedef Reg<BASE + offsetof(GPIO_RegType, DR4R)>   DR4R;
+    typedef Reg<BASE + offsetof(GPIO_RegType, DR8R)>   DR8R;
+    typedef Reg<BASE + offsetof(GPIO_RegType, ODR)>    ODR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, PUR)>    PUR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, PDR)>    PDR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, SLR)>    SLR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, DEN)>    DEN;
+    typedef Reg<BASE + offsetof(GPIO_RegType, LOCK)>   LOCK;
+    typedef Reg<BASE + offsetof(GPIO_RegType, CR)>     CR;
+    typedef Reg<BASE + offsetof(GPIO_RegType, AMSEL)>  AMSEL;
+    typedef Reg<BASE + offsetof(GPIO_RegType, PCTL)>   PCTL;
+    typedef Reg<BASE + offsetof(GPIO_RegType, ADCCTL)> ADCCTL;
+    typedef Reg<BASE + offsetof(GPIO_RegType, DMACTL)> DMACTL;
+
+    /* Masked data alias: writes touch only the pins of PINS_MASK, without read-modify-write */
+    template <uint32 PINS_MASK>
+    struct DataBits : Reg<BASE + (PINS_MASK << 2)>
+    {
+        static_assert(PINS_MASK > 0 && PINS_MASK <= 0xFF, "a GPIO port has 8 pins");
+    };
+
+    /* Port control (alternate function select) field of one pin */
+    template <unsigned PIN>
+    struct PMC : Field<PCTL, PIN * 4, 4> {};
+
+    static const uint32 UNLOCK_KEY = 0x4C4F434B;
+};
+
+typedef GpioPort<GPIO_PORTA_BASE> GpioA;
+typedef GpioPort<GPIO_PORTB_BASE> GpioB;
+typedef GpioPort<GPIO_PORTC_BASE> GpioC;
+typedef GpioPort<GPIO_PORTD_BASE> GpioD;
+typedef GpioPort<GPIO_PORTE_BASE> GpioE;
+typedef GpioPort<GPIO_PORTF_BASE> GpioF;
+
+/*******************************************************************************
+ *                                SysTick                                      *
+ *******************************************************************************/
+struct SysTickCtrl : Reg<SYSTICK_BASE + offsetof(SYSTICK_RegType, CTRL)>
+{
+    typedef Bit<SysTickCtrl, 0>  ENABLE;
+    typedef Bit<SysTickCtrl, 1>  INTEN;
+    typedef Bit<SysTickCtrl, 2>  CLK_SRC;
+    typedef Bit<SysTickCtrl, 16> COUNT;
+};
+
+struct SysTickReload : Reg<SYSTICK_BASE + offsetof(SYSTICK_RegType, RELOAD)>
+{
+    typedef Field<SysTickReload, 0, 24> RELOAD;
+};
+
+struct SysTickCurrent : Reg<SYSTICK_BASE + offsetof(SYSTICK_RegType, CURRENT)>
+{
+    typedef Field<SysTickCurrent, 0, 24> CURRENT;
+};
+
+/*******************************************************************************
+ *                                  NVIC                                       *
+ *******************************************************************************/
+struct Nvic
+{
+    static const unsigned IRQ_NUM = 139;
+
+    template <unsigned N> struct EN  : Reg<NVIC_BASE + offsetof(NVIC_RegType, EN)  + 4 * N> {};
+    template <unsigned N> struct DIS : Reg<NVIC_BASE + offsetof(NVIC_RegType, DIS) + 4 * N> {};
+    template <unsigned N> struct PRI : Reg<NVIC_BASE + offsetof(NVIC_RegType, PRI) + 4 * N> {};
+
+    /* 3 implemented priority bits of an IRQ */
+    template <unsigned IRQ>
+    struct Priority : Field<PRI<IRQ / 4>, 5 + 8 * (IRQ % 4), 3>
+    {
+        static_assert(IRQ < IRQ_NUM, "IRQ number out of range");
+    };
+
+    /* Enable and disable registers are write-one-to-set/clear, so one store is enough */
+    template <unsigned IRQ>
+    static void enableIrq()
+    {
+        static_assert(IRQ < IRQ_NUM, "IRQ number out of range");
+        EN<IRQ / 32>::write(1u << (IRQ % 32));
+    }
+
+    template <unsigned IRQ>
+    static void disableIrq()
+    {
+        static_assert(IRQ < IRQ_NUM, "IRQ number out of range");
+        DIS<IRQ / 32>::write(1u << (IRQ % 32));
+    }
+
+    template <unsigned IRQ, uint32 PRIORITY>
+    static void setPriority()
+    {
+        Priority<IRQ>::template write<PRIORITY>();
+    }
+};
+
+/* System exceptions priority and enable registers, with the field layout of NVIC.h */
+struct SysPri1 : Reg<NVIC_SYSTEM_BASE + offsetof(NVIC_SYSTEM_RegType, PRI1)>
+{
+    typedef Field<SysPri1, MEM_FAULT_PRIORITY_BITS_POS, 3>   MEM;
+    typedef Field<SysPri1, BUS_FAULT_PRIORITY_BITS_POS, 3>   BUS;
+    typedef Field<SysPri1, USAGE_FAULT_PRIORITY_BITS_POS, 3> USAGE;
+};
+
+struct SysPri2 : Reg<NVIC_SYSTEM_BASE + offsetof(NVIC_SYSTEM_RegType, PRI2)>
+{
+    typedef Field<SysPri2, SVC_PRIORITY_BITS_POS, 3> SVC;
+};
+
+struct SysPri3 : Reg<NVIC_SYSTEM_BASE + offsetof(NVIC_SYSTEM_RegType, PRI3)>
+{
+    typedef Field<SysPri3, DEBUG_MONITOR_PRIORITY_BITS_POS, 3> DEBUG_MON;
+    typedef Field<SysPri3, PENDSV_PRIORITY_BITS_POS, 3>        PENDSV;
+    typedef Field<SysPri3, SYSTICK_PRIORITY_BITS_POS, 3>       TICK;
+};
+
+struct SysHndCtrl : Reg<NVIC_SYSTEM_BASE + offsetof(NVIC_SYSTEM_RegType, SYSHNDCTRL)>
+{
+    typedef Bit<SysHndCtrl, 16> MEM;
+    typedef Bit<SysHndCtrl, 17> BUS;
+    typedef Bit<SysHndCtrl, 18> USAGE;
+};
+
+static_assert(SysPri1::MEM::mask == MEM_FAULT_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysPri1::BUS::mask == BUS_FAULT_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysPri1::USAGE::mask == USAGE_FAULT_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysPri2::SVC::mask == SVC_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysPri3::DEBUG_MON::mask == DEBUG_MONITOR_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysPri3::PENDSV::mask == PENDSV_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysPri3::TICK::mask == SYSTICK_PRIORITY_MASK, "NVIC.h mask mismatch");
+static_assert(SysHndCtrl::MEM::mask == MEM_FAULT_ENABLE_MASK, "NVIC.h mask mismatch");
+static_assert(SysHndCtrl::BUS::mask == BUS_FAULT_ENABLE_MASK, "NVIC.h mask mismatch");
+static_assert(SysHndCtrl::USAGE::mask == USAGE_FAULT_ENABLE_MASK, "NVIC.h mask mismatch");
+
+/*******************************************************************************
+ *                             System Control                                  *
+ *******************************************************************************/
+
+/* Run mode clock gating and peripheral ready registers, one bit per GPIO port */
+struct RcgcGpio : Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCGPIO)>
+{
+    template <unsigned PORT> struct PORT_BIT : Bit<RcgcGpio, PORT> {};
+};
+
+struct PrGpio : Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRGPIO)>
+{
+    template <unsigned PORT> struct PORT_BIT : Bit<PrGpio, PORT> {};
+};
+
+typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCUART)> RcgcUart;
+typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRUART)>   PrUart;
+typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCDMA)>  RcgcDma;
+typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRDMA)>    PrDma;
+typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RESC)>     Resc;
+
+/* Every register of SYSCTL_RegType, named as in the structure */
+struct Sysctl
+{
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DID0)>       DID0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DID1)>       DID1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC0)>        DC0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC1)>        DC1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC2)>        DC2;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC3)>        DC3;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC4)>        DC4;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC5)>        DC5;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC6)>        DC6;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC7)>        DC7;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC8)>        DC8;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PBORCTL)>    PBORCTL;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRCR0)>      SRCR0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRCR1)>      SRCR1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRCR2)>      SRCR2;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RIS)>        RIS;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, IMC)>        IMC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, MISC)>       MISC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RESC)>       RESC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCC)>        RCC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, GPIOHBCTL)>  GPIOHBCTL;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCC2)>       RCC2;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, MOSCCTL)>    MOSCCTL;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGC0)>      RCGC0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGC1)>      RCGC1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGC2)>      RCGC2;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGC0)>      SCGC0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGC1)>      SCGC1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGC2)>      SCGC2;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGC0)>      DCGC0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGC1)>      DCGC1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGC2)>      DCGC2;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DSLPCLKCFG)> DSLPCLKCFG;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SYSPROP)>    SYSPROP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PIOSCCAL)>   PIOSCCAL;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PIOSCSTAT)>  PIOSCSTAT;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PLLFREQ0)>   PLLFREQ0;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PLLFREQ1)>   PLLFREQ1;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PLLSTAT)>    PLLSTAT;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DC9)>        DC9;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, NVMSTAT)>    NVMSTAT;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPWD)>       PPWD;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPTIMER)>    PPTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPGPIO)>     PPGPIO;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPDMA)>      PPDMA;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPHIB)>      PPHIB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPUART)>     PPUART;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPSSI)>      PPSSI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPI2C)>      PPI2C;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPUSB)>      PPUSB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPCAN)>      PPCAN;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPADC)>      PPADC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPACMP)>     PPACMP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPPWM)>      PPPWM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPQEI)>      PPQEI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPEEPROM)>   PPEEPROM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PPWTIMER)>   PPWTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRWD)>       SRWD;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRTIMER)>    SRTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRGPIO)>     SRGPIO;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRDMA)>      SRDMA;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRHIB)>      SRHIB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRUART)>     SRUART;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRSSI)>      SRSSI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRI2C)>      SRI2C;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRUSB)>      SRUSB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRCAN)>      SRCAN;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRADC)>      SRADC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRACMP)>     SRACMP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRPWM)>      SRPWM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRQEI)>      SRQEI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SREEPROM)>   SREEPROM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SRWTIMER)>   SRWTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCWD)>     RCGCWD;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCTIMER)>  RCGCTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCGPIO)>   RCGCGPIO;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCDMA)>    RCGCDMA;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCHIB)>    RCGCHIB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCUART)>   RCGCUART;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCSSI)>    RCGCSSI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCI2C)>    RCGCI2C;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCUSB)>    RCGCUSB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCCAN)>    RCGCCAN;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCADC)>    RCGCADC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCACMP)>   RCGCACMP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCPWM)>    RCGCPWM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCQEI)>    RCGCQEI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCEEPROM)> RCGCEEPROM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, RCGCWTIMER)> RCGCWTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCWD)>     SCGCWD;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCTIMER)>  SCGCTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCGPIO)>   SCGCGPIO;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCDMA)>    SCGCDMA;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCHIB)>    SCGCHIB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCUART)>   SCGCUART;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCSSI)>    SCGCSSI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCI2C)>    SCGCI2C;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCUSB)>    SCGCUSB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCCAN)>    SCGCCAN;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCADC)>    SCGCADC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCACMP)>   SCGCACMP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCPWM)>    SCGCPWM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCQEI)>    SCGCQEI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCEEPROM)> SCGCEEPROM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, SCGCWTIMER)> SCGCWTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCWD)>     DCGCWD;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCTIMER)>  DCGCTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCGPIO)>   DCGCGPIO;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCDMA)>    DCGCDMA;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCHIB)>    DCGCHIB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCUART)>   DCGCUART;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCSSI)>    DCGCSSI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCI2C)>    DCGCI2C;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCUSB)>    DCGCUSB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCCAN)>    DCGCCAN;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCADC)>    DCGCADC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCACMP)>   DCGCACMP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCPWM)>    DCGCPWM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCQEI)>    DCGCQEI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCEEPROM)> DCGCEEPROM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, DCGCWTIMER)> DCGCWTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRWD)>       PRWD;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRTIMER)>    PRTIMER;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRGPIO)>     PRGPIO;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRDMA)>      PRDMA;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRHIB)>      PRHIB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRUART)>     PRUART;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRSSI)>      PRSSI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRI2C)>      PRI2C;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRUSB)>      PRUSB;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRCAN)>      PRCAN;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRADC)>      PRADC;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRACMP)>     PRACMP;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRPWM)>      PRPWM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRQEI)>      PRQEI;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PREEPROM)>   PREEPROM;
+    typedef Reg<SYSCTL_BASE + offsetof(SYSCTL_RegType, PRWTIMER)>   PRWTIMER;
+};
+
+/*******************************************************************************
+ *                                  UART                                       *
+ *******************************************************************************/
+template <Address BASE>
+struct UartBlock
+{
+    typedef Reg<BASE + offsetof(UART_RegType, DR)>        DR;
+    typedef Reg<BASE + offsetof(UART_RegType, RSR_ECR)>   RSR_ECR;
+    typedef Reg<BASE + offsetof(UART_RegType, ILPR)>      ILPR;
+    typedef Reg<BASE + offsetof(UART_RegType, IBRD)>      IBRD;
+    typedef Reg<BASE + offsetof(UART_RegType, FBRD)>      FBRD;
+    typedef Reg<BASE + offsetof(UART_RegType, IM)>        IM;
+    typedef Reg<BASE + offsetof(UART_RegType, RIS)>       RIS;
+    typedef Reg<BASE + offsetof(UART_RegType, MIS)>       MIS;
+    typedef Reg<BASE + offsetof(UART_RegType, ICR)>       ICR;
+    typedef Reg<BASE + offsetof(UART_RegType, DMACTL)>    DMACTL;
+    typedef Reg<BASE + offsetof(UART_RegType, BIT9ADDR)>  BIT9ADDR;
+    typedef Reg<BASE + offsetof(UART_RegType, BIT9AMASK)> BIT9AMASK;
+    typedef Reg<BASE + offsetof(UART_RegType, PP)>        PP;
+    typedef Reg<BASE + offsetof(UART_RegType, CC)>        CC;
+
+    struct FR : Reg<BASE + offsetof(UART_RegType, FR)>
+    {
+        typedef Bit<FR, 3> BUSY;
+        typedef Bit<FR, 4> RXFE;
+        typedef Bit<FR, 5> TXFF;
+        typedef Bit<FR, 6> RXFF;
+        typedef Bit<FR, 7> TXFE;
+    };
+
+    struct LCRH : Reg<BASE + offsetof(UART_RegType, LCRH)>
+    {
+        typedef Bit<LCRH, 4>      FEN;
+        typedef Bit<LCRH, 3>      STP2;
+        typedef Field<LCRH, 5, 2> WLEN;
+    };
+
+    struct CTL : Reg<BASE + offsetof(UART_RegType, CTL)>
+    {
+        typedef Bit<CTL, 0> UARTEN;
+        typedef Bit<CTL, 5> HSE;
+        typedef Bit<CTL, 8> TXE;
+        typedef Bit<CTL, 9> RXE;
+    };
+
+    struct IFLS : Reg<BASE + offsetof(UART_RegType, IFLS)>
+    {
+        typedef Field<IFLS, 0, 3> TXIFLSEL;
+        typedef Field<IFLS, 3, 3> RXIFLSEL;
+    };
+};
+
+typedef UartBlock<UART0_BASE> Uart0;
+typedef UartBlock<UART1_BASE> Uart1;
+typedef UartBlock<UART2_BASE> Uart2;
+typedef UartBlock<UART3_BASE> Uart3;
+typedef UartBlock<UART4_BASE> Uart4;
+typedef UartBlock<UART5_BASE> Uart5;
+typedef UartBlock<UART6_BASE> Uart6;
+typedef UartBlock<UART7_BASE> Uart7;
+
+/*******************************************************************************
+ *                                  uDMA                                       *
+ *******************************************************************************/
+struct Udma
+{
+    static const unsigned CHANNELS_NUM = 32;
+
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, CTLBASE)>     CTLBASE;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, ALTBASE)>     ALTBASE;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, WAITSTAT)>    WAITSTAT;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, SWREQ)>       SWREQ;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, USEBURSTSET)> USEBURSTSET;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, USEBURSTCLR)> USEBURSTCLR;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, REQMASKSET)>  REQMASKSET;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, REQMASKCLR)>  REQMASKCLR;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, ENASET)>      ENASET;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, ENACLR)>      ENACLR;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, ALTSET)>      ALTSET;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, ALTCLR)>      ALTCLR;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, PRIOSET)>     PRIOSET;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, PRIOCLR)>     PRIOCLR;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, ERRCLR)>      ERRCLR;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, CHASGN)>      CHASGN;
+    typedef Reg<UDMA_BASE + offsetof(UDMA_RegType, CHIS)>        CHIS;
+
+    struct STAT : Reg<UDMA_BASE + offsetof(UDMA_RegType, STAT)>
+    {
+        typedef Bit<STAT, 0>        MASTEN;
+        typedef Field<STAT, 4, 4>   STATE;
+        typedef Field<STAT, 16, 5>  DMACHANS;
+    };
+
+    struct CFG : Reg<UDMA_BASE + offsetof(UDMA_RegType, CFG)>
+    {
+        typedef Bit<CFG, 0> MASTEN;
+    };
+
+    template <unsigned N> struct CHMAP : Reg<UDMA_BASE + offsetof(UDMA_RegType, CHMAP0) + 4 * N> {};
+
+    /* Peripheral encoding field of a channel, 8 channels per CHMAPn register */
+    template <unsigned CHANNEL>
+    struct ChannelMap : Field<CHMAP<CHANNEL / 8>, 4 * (CHANNEL % 8), 4>
+    {
+        static_assert(CHANNEL < CHANNELS_NUM, "uDMA channel out of range");
+    };
+
+    /* Bit of a channel in the set/clear and status registers above */
+    template <unsigned CHANNEL>
+    struct Channel
+    {
+        static_assert(CHANNEL < CHANNELS_NUM, "uDMA channel out of range");
+        static const uint32 mask = 1u << CHANNEL;
+    };
+
+    /* The set and clear registers are write-one-to-set/clear, so one store is enough */
+    template <unsigned CHANNEL>
+    static void enableChannel() { ENASET::write(Channel<CHANNEL>::mask); }
+
+    template <unsigned CHANNEL>
+    static void disableChannel() { ENACLR::write(Channel<CHANNEL>::mask); }
+
+    template <unsigned CHANNEL>
+    static void request() { SWREQ::write(Channel<CHANNEL>::mask); }
+};
+
+/*******************************************************************************
+ *                      MPU, FPU, DWT and Core Debug                           *
+ *******************************************************************************/
+
+/* System control space registers outside NVIC_SYSTEM_RegType, at the addresses
+ * of the MPU_*, FPU_*, DWT_* and CORE_DEBUG_* register definitions */
+struct Mpu
+{
+    typedef Reg<0xE000ED90> TYPE;
+    typedef Reg<0xE000ED98> NUMBER;
+
+    struct CTRL : Reg<0xE000ED94>
+    {
+        typedef Bit<CTRL, 0> ENABLE;
+        typedef Bit<CTRL, 1> HFNMIENA;
+        typedef Bit<CTRL, 2> PRIVDEFEN;
+    };
+
+    /* Region base address register and its aliases BASE1 - BASE3 (N = 1 - 3) */
+    template <unsigned N>
+    struct BASE : Reg<0xE000ED9C + 8 * N>
+    {
+        static_assert(N < 4, "the MPU has 3 aliases of the region registers");
+        typedef Field<BASE, 0, 3>   REGION;
+        typedef Bit<BASE, 4>        VALID;
+        typedef Field<BASE, 5, 27>  ADDR;
+    };
+
+    /* Region attributes and size register and its aliases ATTR1 - ATTR3 */
+    template <unsigned N>
+    struct ATTR : Reg<0xE000EDA0 + 8 * N>
+    {
+        static_assert(N < 4, "the MPU has 3 aliases of the region registers");
+        typedef Bit<ATTR, 0>        ENABLE;
+        typedef Field<ATTR, 1, 5>   SIZE;
+        typedef Field<ATTR, 8, 8>   SRD;
+        typedef Bit<ATTR, 16>       B;
+        typedef Bit<ATTR, 17>       C;
+        typedef Bit<ATTR, 18>       S;
+        typedef Field<ATTR, 19, 3>  TEX;
+        typedef Field<ATTR, 24, 3>  AP;
+        typedef Bit<ATTR, 28>       XN;
+    };
+};
+
+struct Fpu
+{
+    typedef Reg<0xE000EF38> FPCA;
+
+    struct CPACR : Reg<0xE000ED88>
+    {
+        typedef Field<CPACR, 20, 2> CP10;
+        typedef Field<CPACR, 22, 2> CP11;
+    };
+
+    struct FPCC : Reg<0xE000EF34>
+    {
+        typedef Bit<FPCC, 0>  LSPACT;
+        typedef Bit<FPCC, 30> LSPEN;
+        typedef Bit<FPCC, 31> ASPEN;
+    };
+
+    struct FPDSC : Reg<0xE000EF3C>
+    {
+        typedef Field<FPDSC, 22, 2> RMODE;
+        typedef Bit<FPDSC, 24>      FZ;
+        typedef Bit<FPDSC, 25>      DN;
+        typedef Bit<FPDSC, 26>      AHP;
+    };
+};
+
+struct Dwt
+{
+    typedef Reg<0xE0001004> CYCCNT;
+
+    struct CTRL : Reg<0xE0001000>
+    {
+        typedef Bit<CTRL, 0> CYCCNTENA;
+    };
+};
+
+struct CoreDebugDemcr : Reg<0xE000EDFC>
+{
+    typedef Bit<CoreDebugDemcr, 24> TRCENA;
+};
+
+} /* namespace tm4c */
+
+#endif /* TM4C123GH6PM_REGISTERS_HPP_ */
@@ -23,6 +23,8 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include "Startup.h"
+#include "BootProfile.h"
 
 //*****************************************************************************
 //
@@ -31,10 +33,21 @@
 //*****************************************************************************
 void ResetISR(void);
 static void NmiSR(void);
-static void FaultISR(void);
-static void IntDefaultHandler(void);
 extern void SysTick_Handler(void);
 extern void GPIOPortF_Handler(void);
+extern void UART0_Handler(void);
+extern void UDMA_Software_Handler(void);
+extern void UDMA_Error_Handler(void);
+
+//*****************************************************************************
+//
+// The faults and every unexpected interrupt go straight to the fault capture,
+// which saves the fault in no-init RAM and resets the system.  It finds the
+// exception frame through the SP and EXC_RETURN, so no C function may run in
+// between, see FaultCapture.c.
+//
+//*****************************************************************************
+extern void FaultCapture_Handler(void);
 
 //*****************************************************************************
 //
@@ -72,91 +85,91 @@ void (* const g_pfnVectors[])(void) =
                                             // The initial stack pointer
     ResetISR,                               // The reset handler
     NmiSR,                                  // The NMI handler
-    FaultISR,                               // The hard fault handler
-    IntDefaultHandler,                      // The MPU fault handler
-    IntDefaultHandler,                       // The bus fault handler
-    IntDefaultHandler,                      // The usage fault handler
+    FaultCapture_Handler,                   // The hard fault handler
+    FaultCapture_Handler,                   // The MPU fault handler
+    FaultCapture_Handler,                    // The bus fault handler
+    FaultCapture_Handler,                   // The usage fault handler
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // SVCall handler
-    IntDefaultHandler,                      // Debug monitor handler
+    FaultCapture_Handler,                   // SVCall handler
+    FaultCapture_Handler,                   // Debug monitor handler
     0,                                      // Reserved
-    IntDefaultHandler,                      // The PendSV handler
+    FaultCapture_Handler,                   // The PendSV handler
     SysTick_Handler,                      // The SysTick handler
-    IntDefaultHandler,                      // GPIO Port A
-    IntDefaultHandler,                      // GPIO Port B
-    IntDefaultHandler,                      // GPIO Port C
-    IntDefaultHandler,                      // GPIO Port D
-    IntDefaultHandler,                      // GPIO Port E
-    IntDefaultHandler,                      // UART0 Rx and Tx
-    IntDefaultHandler,                      // UART1 Rx and Tx
-    IntDefaultHandler,                      // SSI0 Rx and Tx
-    IntDefaultHandler,                      // I2C0 Master and Slave
-    IntDefaultHandler,                      // PWM Fault
-    IntDefaultHandler,                      // PWM Generator 0
-    IntDefaultHandler,                      // PWM Generator 1
-    IntDefaultHandler,                      // PWM Generator 2
-    IntDefaultHandler,                      // Quadrature Encoder 0
-    IntDefaultHandler,                      // ADC Sequence 0
-    IntDefaultHandler,                      // ADC Sequence 1
-    IntDefaultHandler,                      // ADC Sequence 2
-    IntDefaultHandler,                      // ADC Sequence 3
-    IntDefaultHandler,                      // Watchdog timer
-    IntDefaultHandler,                      // Timer 0 subtimer A
-    IntDefaultHandler,                      // Timer 0 subtimer B
-    IntDefaultHandler,                      // Timer 1 subtimer A
-    IntDefaultHandler,                      // Timer 1 subtimer B
-    IntDefaultHandler,                      // Timer 2 subtimer A
-    IntDefaultHandler,                      // Timer 2 subtimer B
-    IntDefaultHandler,                      // Analog Comparator 0
-    IntDefaultHandler,                      // Analog Comparator 1
-    IntDefaultHandler,                      // Analog Comparator 2
-    IntDefaultHandler,                      // System Control (PLL, OSC, BO)
-    IntDefaultHandler,                      // FLASH Control
+    FaultCapture_Handler,                   // GPIO Port A
+    FaultCapture_Handler,                   // GPIO Port B
+    FaultCapture_Handler,                   // GPIO Port C
+    FaultCapture_Handler,                   // GPIO Port D
+    FaultCapture_Handler,                   // GPIO Port E
+    UART0_Handler,                          // UART0 Rx and Tx
+    FaultCapture_Handler,                   // UART1 Rx and Tx
+    FaultCapture_Handler,                   // SSI0 Rx and Tx
+    FaultCapture_Handler,                   // I2C0 Master and Slave
+    FaultCapture_Handler,                   // PWM Fault
+    FaultCapture_Handler,                   // PWM Generator 0
+    FaultCapture_Handler,                   // PWM Generator 1
+    FaultCapture_Handler,                   // PWM Generator 2
+    FaultCapture_Handler,                   // Quadrature Encoder 0
+    FaultCapture_Handler,                   // ADC Sequence 0
+    FaultCapture_Handler,                   // ADC Sequence 1
+    FaultCapture_Handler,                   // ADC Sequence 2
+    FaultCapture_Handler,                   // ADC Sequence 3
+    FaultCapture_Handler,                   // Watchdog timer
+    FaultCapture_Handler,                   // Timer 0 subtimer A
+    FaultCapture_Handler,                   // Timer 0 subtimer B
+    FaultCapture_Handler,                   // Timer 1 subtimer A
+    FaultCapture_Handler,                   // Timer 1 subtimer B
+    FaultCapture_Handler,                   // Timer 2 subtimer A
+    FaultCapture_Handler,                   // Timer 2 subtimer B
+    FaultCapture_Handler,                   // Analog Comparator 0
+    FaultCapture_Handler,                   // Analog Comparator 1
+    FaultCapture_Handler,                   // Analog Comparator 2
+    FaultCapture_Handler,                   // System Control (PLL, OSC, BO)
+    FaultCapture_Handler,                   // FLASH Control
     GPIOPortF_Handler,                      // GPIO Port F
-    IntDefaultHandler,                      // GPIO Port G
-    IntDefaultHandler,                      // GPIO Port H
-    IntDefaultHandler,                      // UART2 Rx and Tx
-    IntDefaultHandler,                      // SSI1 Rx and Tx
-    IntDefaultHandler,                      // Timer 3 subtimer A
-    IntDefaultHandler,                      // Timer 3 subtimer B
-    IntDefaultHandler,                      // I2C1 Master and Slave
-    IntDefaultHandler,                      // Quadrature Encoder 1
-    IntDefaultHandler,                      // CAN0
-    IntDefaultHandler,                      // CAN1
+    FaultCapture_Handler,                   // GPIO Port G
+    FaultCapture_Handler,                   // GPIO Port H
+    FaultCapture_Handler,                   // UART2 Rx and Tx
+    FaultCapture_Handler,                   // SSI1 Rx and Tx
+    FaultCapture_Handler,                   // Timer 3 subtimer A
+    FaultCapture_Handler,                   // Timer 3 subtimer B
+    FaultCapture_Handler,                   // I2C1 Master and Slave
+    FaultCapture_Handler,                   // Quadrature Encoder 1
+    FaultCapture_Handler,                   // CAN0
+    FaultCapture_Handler,                   // CAN1
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // Hibernate
-    IntDefaultHandler,                      // USB0
-    IntDefaultHandler,                      // PWM Generator 3
-    IntDefaultHandler,                      // uDMA Software Transfer
-    IntDefaultHandler,                      // uDMA Error
-    IntDefaultHandler,                      // ADC1 Sequence 0
-    IntDefaultHandler,                      // ADC1 Sequence 1
-    IntDefaultHandler,                      // ADC1 Sequence 2
-    IntDefaultHandler,                      // ADC1 Sequence 3
+    FaultCapture_Handler,                   // Hibernate
+    FaultCapture_Handler,                   // USB0
+    FaultCapture_Handler,                   // PWM Generator 3
+    UDMA_Software_Handler,                  // uDMA Software Transfer
+    UDMA_Error_Handler,                     // uDMA Error
+    FaultCapture_Handler,                   // ADC1 Sequence 0
+    FaultCapture_Handler,                   // ADC1 Sequence 1
+    FaultCapture_Handler,                   // ADC1 Sequence 2
+    FaultCapture_Handler,                   // ADC1 Sequence 3
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // GPIO Port J
-    IntDefaultHandler,                      // GPIO Port K
-    IntDefaultHandler,                      // GPIO Port L
-    IntDefaultHandler,                      // SSI2 Rx and Tx
-    IntDefaultHandler,                      // SSI3 Rx and Tx
-    IntDefaultHandler,                      // UART3 Rx and Tx
-    IntDefaultHandler,                      // UART4 Rx and Tx
-    IntDefaultHandler,                      // UART5 Rx and Tx
-    IntDefaultHandler,                      // UART6 Rx and Tx
-    IntDefaultHandler,                      // UART7 Rx and Tx
+    FaultCapture_Handler,                   // GPIO Port J
+    FaultCapture_Handler,                   // GPIO Port K
+    FaultCapture_Handler,                   // GPIO Port L
+    FaultCapture_Handler,                   // SSI2 Rx and Tx
+    FaultCapture_Handler,                   // SSI3 Rx and Tx
+    FaultCapture_Handler,                   // UART3 Rx and Tx
+    FaultCapture_Handler,                   // UART4 Rx and Tx
+    FaultCapture_Handler,                   // UART5 Rx and Tx
+    FaultCapture_Handler,                   // UART6 Rx and Tx
+    FaultCapture_Handler,                   // UART7 Rx and Tx
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // I2C2 Master and Slave
-    IntDefaultHandler,                      // I2C3 Master and Slave
-    IntDefaultHandler,                      // Timer 4 subtimer A
-    IntDefaultHandler,                      // Timer 4 subtimer B
+    FaultCapture_Handler,                   // I2C2 Master and Slave
+    FaultCapture_Handler,                   // I2C3 Master and Slave
+    FaultCapture_Handler,                   // Timer 4 subtimer A
+    FaultCapture_Handler,                   // Timer 4 subtimer B
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
@@ -177,53 +190,53 @@ void (* const g_pfnVectors[])(void) =
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // Timer 5 subtimer A
-    IntDefaultHandler,                      // Timer 5 subtimer B
-    IntDefaultHandler,                      // Wide Timer 0 subtimer A
-    IntDefaultHandler,                      // Wide Timer 0 subtimer B
-    IntDefaultHandler,                      // Wide Timer 1 subtimer A
-    IntDefaultHandler,                      // Wide Timer 1 subtimer B
-    IntDefaultHandler,                      // Wide Timer 2 subtimer A
-    IntDefaultHandler,                      // Wide Timer 2 subtimer B
-    IntDefaultHandler,                      // Wide Timer 3 subtimer A
-    IntDefaultHandler,                      // Wide Timer 3 subtimer B
-    IntDefaultHandler,                      // Wide Timer 4 subtimer A
-    IntDefaultHandler,                      // Wide Timer 4 subtimer B
-    IntDefaultHandler,                      // Wide Timer 5 subtimer A
-    IntDefaultHandler,                      // Wide Timer 5 subtimer B
-    IntDefaultHandler,                      // FPU
+    FaultCapture_Handler,                   // Timer 5 subtimer A
+    FaultCapture_Handler,                   // Timer 5 subtimer B
+    FaultCapture_Handler,                   // Wide Timer 0 subtimer A
+    FaultCapture_Handler,                   // Wide Timer 0 subtimer B
+    FaultCapture_Handler,                   // Wide Timer 1 subtimer A
+    FaultCapture_Handler,                   // Wide Timer 1 subtimer B
+    FaultCapture_Handler,                   // Wide Timer 2 subtimer A
+    FaultCapture_Handler,                   // Wide Timer 2 subtimer B
+    FaultCapture_Handler,                   // Wide Timer 3 subtimer A
+    FaultCapture_Handler,                   // Wide Timer 3 subtimer B
+    FaultCapture_Handler,                   // Wide Timer 4 subtimer A
+    FaultCapture_Handler,                   // Wide Timer 4 subtimer B
+    FaultCapture_Handler,                   // Wide Timer 5 subtimer A
+    FaultCapture_Handler,                   // Wide Timer 5 subtimer B
+    FaultCapture_Handler,                   // FPU
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // I2C4 Master and Slave
-    IntDefaultHandler,                      // I2C5 Master and Slave
-    IntDefaultHandler,                      // GPIO Port M
-    IntDefaultHandler,                      // GPIO Port N
-    IntDefaultHandler,                      // Quadrature Encoder 2
+    FaultCapture_Handler,                   // I2C4 Master and Slave
+    FaultCapture_Handler,                   // I2C5 Master and Slave
+    FaultCapture_Handler,                   // GPIO Port M
+    FaultCapture_Handler,                   // GPIO Port N
+    FaultCapture_Handler,                   // Quadrature Encoder 2
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // GPIO Port P (Summary or P0)
-    IntDefaultHandler,                      // GPIO Port P1
-    IntDefaultHandler,                      // GPIO Port P2
-    IntDefaultHandler,                      // GPIO Port P3
-    IntDefaultHandler,                      // GPIO Port P4
-    IntDefaultHandler,                      // GPIO Port P5
-    IntDefaultHandler,                      // GPIO Port P6
-    IntDefaultHandler,                      // GPIO Port P7
-    IntDefaultHandler,                      // GPIO Port Q (Summary or Q0)
-    IntDefaultHandler,                      // GPIO Port Q1
-    IntDefaultHandler,                      // GPIO Port Q2
-    IntDefaultHandler,                      // GPIO Port Q3
-    IntDefaultHandler,                      // GPIO Port Q4
-    IntDefaultHandler,                      // GPIO Port Q5
-    IntDefaultHandler,                      // GPIO Port Q6
-    IntDefaultHandler,                      // GPIO Port Q7
-    IntDefaultHandler,                      // GPIO Port R
-    IntDefaultHandler,                      // GPIO Port S
-    IntDefaultHandler,                      // PWM 1 Generator 0
-    IntDefaultHandler,                      // PWM 1 Generator 1
-    IntDefaultHandler,                      // PWM 1 Generator 2
-    IntDefaultHandler,                      // PWM 1 Generator 3
-    IntDefaultHandler                       // PWM 1 Fault
+    FaultCapture_Handler,                   // GPIO Port P (Summary or P0)
+    FaultCapture_Handler,                   // GPIO Port P1
+    FaultCapture_Handler,                   // GPIO Port P2
+    FaultCapture_Handler,                   // GPIO Port P3
+    FaultCapture_Handler,                   // GPIO Port P4
+    FaultCapture_Handler,                   // GPIO Port P5
+    FaultCapture_Handler,                   // GPIO Port P6
+    FaultCapture_Handler,                   // GPIO Port P7
+    FaultCapture_Handler,                   // GPIO Port Q (Summary or Q0)
+    FaultCapture_Handler,                   // GPIO Port Q1
+    FaultCapture_Handler,                   // GPIO Port Q2
+    FaultCapture_Handler,                   // GPIO Port Q3
+    FaultCapture_Handler,                   // GPIO Port Q4
+    FaultCapture_Handler,                   // GPIO Port Q5
+    FaultCapture_Handler,                   // GPIO Port Q6
+    FaultCapture_Handler,                   // GPIO Port Q7
+    FaultCapture_Handler,                   // GPIO Port R
+    FaultCapture_Handler,                   // GPIO Port S
+    FaultCapture_Handler,                   // PWM 1 Generator 0
+    FaultCapture_Handler,                   // PWM 1 Generator 1
+    FaultCapture_Handler,                   // PWM 1 Generator 2
+    FaultCapture_Handler,                   // PWM 1 Generator 3
+    FaultCapture_Handler                    // PWM 1 Fault
 };
 
 //*****************************************************************************
@@ -239,12 +252,26 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    //
+    // Start the cycle counter, the boot profile counts from here.
+    //
+    BootProfile_Start();
+
+#if (STARTUP_LEAN == TRUE)
+    //
+    // Jump to the project startup, it enables the floating-point unit,
+    // initializes .data and .bss and calls main().
+    //
+    __asm("    .global Startup_Lean\n"
+          "    b.w     Startup_Lean");
+#else
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.
     //
     __asm("    .global _c_int00\n"
           "    b.w     _c_int00");
+#endif
 }
 
 //*****************************************************************************
@@ -264,39 +291,3 @@ NmiSR(void)
     {
     }
 }
-
-//*****************************************************************************
-//
-// This is the code that gets called when the processor receives a fault
-// interrupt.  This simply enters an infinite loop, preserving the system state
-// for examination by a debugger.
-//
-//*****************************************************************************
-static void
-FaultISR(void)
-{
-    //
-    // Enter an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
-
-//*****************************************************************************
-//
-// This is the code that gets called when the processor receives an unexpected
-// interrupt.  This simply enters an infinite loop, preserving the system state
-// for examination by a debugger.
-//
-//*****************************************************************************
-static void
-IntDefaultHandler(void)
-{
-    //
-    // Go into an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
@@ -1,6 +1,7 @@
 #ifndef TM4C123GH6PM_REGISTERS
 #define TM4C123GH6PM_REGISTERS
 
+#include <stddef.h>
 #include "std_types.h"
 
 /*****************************************************************************
@@ -217,6 +218,22 @@ MPU Registers
 #define MPU_BASE3_REG             (*((volatile uint32 *)0xE000EDB4))
 #define MPU_ATTR3_REG             (*((volatile uint32 *)0xE000EDB8))
 
+/*****************************************************************************
+Floating-Point Unit Registers
+*****************************************************************************/
+#define FPU_CPACR_REG             (*((volatile uint32 *)0xE000ED88))
+#define FPU_FPCC_REG              (*((volatile uint32 *)0xE000EF34))
+#define FPU_FPCA_REG              (*((volatile uint32 *)0xE000EF38))
+#define FPU_FPDSC_REG             (*((volatile uint32 *)0xE000EF3C))
+
+/*****************************************************************************
+Data Watchpoint and Trace (DWT) and Core Debug Registers
+*****************************************************************************/
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+#define CORE_DEBUG_DHCSR_REG      (*((volatile uint32 *)0xE000EDF0))
+#define CORE_DEBUG_DEMCR_REG      (*((volatile uint32 *)0xE000EDFC))
+
 /*****************************************************************************
 System Control Registers
 *****************************************************************************/
@@ -438,4 +455,636 @@ Flash Registers
 #define FLASH_FMPPE2_REG          (*((volatile uint32 *)0x400FE408))
 #define FLASH_FMPPE3_REG          (*((volatile uint32 *)0x400FE40C))
 
+/*****************************************************************************
+Peripheral register structures
+The structures below overlay a whole peripheral block, so a driver can take the
+block base pointer as a parameter (e.g. one GPIO driver for all the ports) and
+the compiler can keep the base address in one register across the accesses.
+*****************************************************************************/
+
+/* GPIO port (APB aperture), DATA_BITS[n] is the masked data alias for the bits of n */
+typedef struct
+{
+    volatile uint32 DATA_BITS[255];  /* 0x000 */
+    volatile uint32 DATA;            /* 0x3FC */
+    volatile uint32 DIR;             /* 0x400 */
+    volatile uint32 IS;              /* 0x404 */
+    volatile uint32 IBE;             /* 0x408 */
+    volatile uint32 IEV;             /* 0x40C */
+    volatile uint32 IM;              /* 0x410 */
+    volatile uint32 RIS;             /* 0x414 */
+    volatile uint32 MIS;             /* 0x418 */
+    volatile uint32 ICR;             /* 0x41C */
+    volatile uint32 AFSEL;           /* 0x420 */
+    uint32          RESERVED0[55];   /* 0x424 - 0x4FC */
+    volatile uint32 DR2R;            /* 0x500 */
+    volatile uint32 DR4R;            /* 0x504 */
+    volatile uint32 DR8R;            /* 0x508 */
+    volatile uint32 ODR;             /* 0x50C */
+    volatile uint32 PUR;             /* 0x510 */
+    volatile uint32 PDR;             /* 0x514 */
+    volatile uint32 SLR;             /* 0x518 */
+    volatile uint32 DEN;             /* 0x51C */
+    volatile uint32 LOCK;            /* 0x520 */
+    volatile uint32 CR;              /* 0x524 */
+    volatile uint32 AMSEL;           /* 0x528 */
+    volatile uint32 PCTL;            /* 0x52C */
+    volatile uint32 ADCCTL;          /* 0x530 */
+    volatile uint32 DMACTL;          /* 0x534 */
+}GPIO_RegType;
+
+#define GPIO_PORTA_BASE           0x40004000
+#define GPIO_PORTB_BASE           0x40005000
+#define GPIO_PORTC_BASE           0x40006000
+#define GPIO_PORTD_BASE           0x40007000
+#define GPIO_PORTE_BASE           0x40024000
+#define GPIO_PORTF_BASE           0x40025000
+
+#define GPIO_PORTA                ((GPIO_RegType *)GPIO_PORTA_BASE)
+#define GPIO_PORTB                ((GPIO_RegType *)GPIO_PORTB_BASE)
+#define GPIO_PORTC                ((GPIO_RegType *)GPIO_PORTC_BASE)
+#define GPIO_PORTD                ((GPIO_RegType *)GPIO_PORTD_BASE)
+#define GPIO_PORTE                ((GPIO_RegType *)GPIO_PORTE_BASE)
+#define GPIO_PORTF                ((GPIO_RegType *)GPIO_PORTF_BASE)
+
+/* UART */
+typedef struct
+{
+    volatile uint32 DR;              /* 0x000 */
+    volatile uint32 RSR_ECR;         /* 0x004 */
+    uint32          RESERVED0[4];    /* 0x008 - 0x014 */
+    volatile uint32 FR;              /* 0x018 */
+    uint32          RESERVED1[1];    /* 0x01C */
+    volatile uint32 ILPR;            /* 0x020 */
+    volatile uint32 IBRD;            /* 0x024 */
+    volatile uint32 FBRD;            /* 0x028 */
+    volatile uint32 LCRH;            /* 0x02C */
+    volatile uint32 CTL;             /* 0x030 */
+    volatile uint32 IFLS;            /* 0x034 */
+    volatile uint32 IM;              /* 0x038 */
+    volatile uint32 RIS;             /* 0x03C */
+    volatile uint32 MIS;             /* 0x040 */
+    volatile uint32 ICR;             /* 0x044 */
+    volatile uint32 DMACTL;          /* 0x048 */
+    uint32          RESERVED2[22];   /* 0x04C - 0x0A0 */
+    volatile uint32 BIT9ADDR;        /* 0x0A4 */
+    volatile uint32 BIT9AMASK;       /* 0x0A8 */
+    uint32          RESERVED3[965];  /* 0x0AC - 0xFBC */
+    volatile uint32 PP;              /* 0xFC0 */
+    uint32          RESERVED4[1];    /* 0xFC4 */
+    volatile uint32 CC;              /* 0xFC8 */
+}UART_RegType;
+
+#define UART0_BASE                0x4000C000
+#define UART1_BASE                0x4000D000
+#define UART2_BASE                0x4000E000
+#define UART3_BASE                0x4000F000
+#define UART4_BASE                0x40010000
+#define UART5_BASE                0x40011000
+#define UART6_BASE                0x40012000
+#define UART7_BASE                0x40013000
+
+#define UART0                     ((UART_RegType *)UART0_BASE)
+#define UART1                     ((UART_RegType *)UART1_BASE)
+#define UART2                     ((UART_RegType *)UART2_BASE)
+#define UART3                     ((UART_RegType *)UART3_BASE)
+#define UART4                     ((UART_RegType *)UART4_BASE)
+#define UART5                     ((UART_RegType *)UART5_BASE)
+#define UART6                     ((UART_RegType *)UART6_BASE)
+#define UART7                     ((UART_RegType *)UART7_BASE)
+
+/* uDMA controller */
+typedef struct
+{
+    volatile uint32 STAT;            /* 0x000 */
+    volatile uint32 CFG;             /* 0x004 */
+    volatile uint32 CTLBASE;         /* 0x008 */
+    volatile uint32 ALTBASE;         /* 0x00C */
+    volatile uint32 WAITSTAT;        /* 0x010 */
+    volatile uint32 SWREQ;           /* 0x014 */
+    volatile uint32 USEBURSTSET;     /* 0x018 */
+    volatile uint32 USEBURSTCLR;     /* 0x01C */
+    volatile uint32 REQMASKSET;      /* 0x020 */
+    volatile uint32 REQMASKCLR;      /* 0x024 */
+    volatile uint32 ENASET;          /* 0x028 */
+    volatile uint32 ENACLR;          /* 0x02C */
+    volatile uint32 ALTSET;          /* 0x030 */
+    volatile uint32 ALTCLR;          /* 0x034 */
+    volatile uint32 PRIOSET;         /* 0x038 */
+    volatile uint32 PRIOCLR;         /* 0x03C */
+    uint32          RESERVED0[3];    /* 0x040 - 0x048 */
+    volatile uint32 ERRCLR;          /* 0x04C */
+    uint32          RESERVED1[300];  /* 0x050 - 0x4FC */
+    volatile uint32 CHASGN;          /* 0x500 */
+    volatile uint32 CHIS;            /* 0x504 */
+    uint32          RESERVED2[2];    /* 0x508 - 0x50C */
+    volatile uint32 CHMAP0;          /* 0x510 */
+    volatile uint32 CHMAP1;          /* 0x514 */
+    volatile uint32 CHMAP2;          /* 0x518 */
+    volatile uint32 CHMAP3;          /* 0x51C */
+}UDMA_RegType;
+
+#define UDMA_BASE                 0x400FF000
+#define UDMA                      ((UDMA_RegType *)UDMA_BASE)
+
+/* uDMA channel control structure (one entry of the channel control table in SRAM) */
+typedef struct
+{
+    volatile uint32 SRCENDP;      /* Source address end pointer */
+    volatile uint32 DSTENDP;      /* Destination address end pointer */
+    volatile uint32 CHCTL;        /* Channel control word */
+    uint32 RESERVED;
+}UDMA_ControlEntryType;
+
+/* SysTick timer */
+typedef struct
+{
+    volatile uint32 CTRL;     /* 0x000 */
+    volatile uint32 RELOAD;   /* 0x004 */
+    volatile uint32 CURRENT;  /* 0x008 */
+}SYSTICK_RegType;
+
+#define SYSTICK_BASE              0xE000E010
+#define SYSTICK                   ((SYSTICK_RegType *)SYSTICK_BASE)
+
+/* NVIC interrupt enable, pending, active and priority registers */
+typedef struct
+{
+    volatile uint32 EN[5];           /* 0x000 */
+    uint32          RESERVED0[27];   /* 0x014 - 0x07C */
+    volatile uint32 DIS[5];          /* 0x080 */
+    uint32          RESERVED1[27];   /* 0x094 - 0x0FC */
+    volatile uint32 PEND[5];         /* 0x100 */
+    uint32          RESERVED2[27];   /* 0x114 - 0x17C */
+    volatile uint32 UNPEND[5];       /* 0x180 */
+    uint32          RESERVED3[27];   /* 0x194 - 0x1FC */
+    volatile uint32 ACTIVE[5];       /* 0x200 */
+    uint32          RESERVED4[59];   /* 0x214 - 0x2FC */
+    volatile uint32 PRI[35];         /* 0x300 */
+    uint32          RESERVED5[669];  /* 0x38C - 0xDFC */
+    volatile uint32 SWTRIG;          /* 0xE00 */
+}NVIC_RegType;
+
+#define NVIC_BASE                 0xE000E100
+#define NVIC                      ((NVIC_RegType *)NVIC_BASE)
+
+/* NVIC system control block (system exceptions control, priority and fault status) */
+typedef struct
+{
+    volatile uint32 CPUID;       /* 0x000 */
+    volatile uint32 INTCTRL;     /* 0x004 */
+    volatile uint32 VTABLE;      /* 0x008 */
+    volatile uint32 APINT;       /* 0x00C */
+    volatile uint32 SYSCTRL;     /* 0x010 */
+    volatile uint32 CFGCTRL;     /* 0x014 */
+    volatile uint32 PRI1;        /* 0x018 */
+    volatile uint32 PRI2;        /* 0x01C */
+    volatile uint32 PRI3;        /* 0x020 */
+    volatile uint32 SYSHNDCTRL;  /* 0x024 */
+    volatile uint32 FAULTSTAT;   /* 0x028 */
+    volatile uint32 HFAULTSTAT;  /* 0x02C */
+    volatile uint32 DEBUGSTAT;   /* 0x030 */
+    volatile uint32 MMADDR;      /* 0x034 */
+    volatile uint32 FAULTADDR;   /* 0x038 */
+}NVIC_SYSTEM_RegType;
+
+#define NVIC_SYSTEM_BASE          0xE000ED00
+#define NVIC_SYSTEM               ((NVIC_SYSTEM_RegType *)NVIC_SYSTEM_BASE)
+
+/* System control */
+typedef struct
+{
+    volatile uint32 DID0;             /* 0x000 */
+    volatile uint32 DID1;             /* 0x004 */
+    volatile uint32 DC0;              /* 0x008 */
+    uint32          RESERVED0[1];     /* 0x00C */
+    volatile uint32 DC1;              /* 0x010 */
+    volatile uint32 DC2;              /* 0x014 */
+    volatile uint32 DC3;              /* 0x018 */
+    volatile uint32 DC4;              /* 0x01C */
+    volatile uint32 DC5;              /* 0x020 */
+    volatile uint32 DC6;              /* 0x024 */
+    volatile uint32 DC7;              /* 0x028 */
+    volatile uint32 DC8;              /* 0x02C */
+    volatile uint32 PBORCTL;          /* 0x030 */
+    uint32          RESERVED1[3];     /* 0x034 - 0x03C */
+    volatile uint32 SRCR0;            /* 0x040 */
+    volatile uint32 SRCR1;            /* 0x044 */
+    volatile uint32 SRCR2;            /* 0x048 */
+    uint32          RESERVED2[1];     /* 0x04C */
+    volatile uint32 RIS;              /* 0x050 */
+    volatile uint32 IMC;              /* 0x054 */
+    volatile uint32 MISC;             /* 0x058 */
+    volatile uint32 RESC;             /* 0x05C */
+    volatile uint32 RCC;              /* 0x060 */
+    uint32          RESERVED3[2];     /* 0x064 - 0x068 */
+    volatile uint32 GPIOHBCTL;        /* 0x06C */
+    volatile uint32 RCC2;             /* 0x070 */
+    uint32          RESERVED4[2];     /* 0x074 - 0x078 */
+    volatile uint32 MOSCCTL;          /* 0x07C */
+    uint32          RESERVED5[32];    /* 0x080 - 0x0FC */
+    volatile uint32 RCGC0;            /* 0x100 */
+    volatile uint32 RCGC1;            /* 0x104 */
+    volatile uint32 RCGC2;            /* 0x108 */
+    uint32          RESERVED6[1];     /* 0x10C */
+    volatile uint32 SCGC0;            /* 0x110 */
+    volatile uint32 SCGC1;            /* 0x114 */
+    volatile uint32 SCGC2;            /* 0x118 */
+    uint32          RESERVED7[1];     /* 0x11C */
+    volatile uint32 DCGC0;            /* 0x120 */
+    volatile uint32 DCGC1;            /* 0x124 */
+    volatile uint32 DCGC2;            /* 0x128 */
+    uint32          RESERVED8[6];     /* 0x12C - 0x140 */
+    volatile uint32 DSLPCLKCFG;       /* 0x144 */
+    uint32          RESERVED9[1];     /* 0x148 */
+    volatile uint32 SYSPROP;          /* 0x14C */
+    volatile uint32 PIOSCCAL;         /* 0x150 */
+    volatile uint32 PIOSCSTAT;        /* 0x154 */
+    uint32          RESERVED10[2];    /* 0x158 - 0x15C */
+    volatile uint32 PLLFREQ0;         /* 0x160 */
+    volatile uint32 PLLFREQ1;         /* 0x164 */
+    volatile uint32 PLLSTAT;          /* 0x168 */
+    uint32          RESERVED11[9];    /* 0x16C - 0x18C */
+    volatile uint32 DC9;              /* 0x190 */
+    uint32          RESERVED12[3];    /* 0x194 - 0x19C */
+    volatile uint32 NVMSTAT;          /* 0x1A0 */
+    uint32          RESERVED13[87];   /* 0x1A4 - 0x2FC */
+    volatile uint32 PPWD;             /* 0x300 */
+    volatile uint32 PPTIMER;          /* 0x304 */
+    volatile uint32 PPGPIO;           /* 0x308 */
+    volatile uint32 PPDMA;            /* 0x30C */
+    uint32          RESERVED14[1];    /* 0x310 */
+    volatile uint32 PPHIB;            /* 0x314 */
+    volatile uint32 PPUART;           /* 0x318 */
+    volatile uint32 PPSSI;            /* 0x31C */
+    volatile uint32 PPI2C;            /* 0x320 */
+    uint32          RESERVED15[1];    /* 0x324 */
+    volatile uint32 PPUSB;            /* 0x328 */
+    uint32          RESERVED16[2];    /* 0x32C - 0x330 */
+    volatile uint32 PPCAN;            /* 0x334 */
+    volatile uint32 PPADC;            /* 0x338 */
+    volatile uint32 PPACMP;           /* 0x33C */
+    volatile uint32 PPPWM;            /* 0x340 */
+    volatile uint32 PPQEI;            /* 0x344 */
+    uint32          RESERVED17[4];    /* 0x348 - 0x354 */
+    volatile uint32 PPEEPROM;         /* 0x358 */
+    volatile uint32 PPWTIMER;         /* 0x35C */
+    uint32          RESERVED18[104];  /* 0x360 - 0x4FC */
+    volatile uint32 SRWD;             /* 0x500 */
+    volatile uint32 SRTIMER;          /* 0x504 */
+    volatile uint32 SRGPIO;           /* 0x508 */
+    volatile uint32 SRDMA;            /* 0x50C */
+    uint32          RESERVED19[1];    /* 0x510 */
+    volatile uint32 SRHIB;            /* 0x514 */
+    volatile uint32 SRUART;           /* 0x518 */
+    volatile uint32 SRSSI;            /* 0x51C */
+    volatile uint32 SRI2C;            /* 0x520 */
+    uint32          RESERVED20[1];    /* 0x524 */
+    volatile uint32 SRUSB;            /* 0x528 */
+    uint32          RESERVED21[2];    /* 0x52C - 0x530 */
+    volatile uint32 SRCAN;            /* 0x534 */
+    volatile uint32 SRADC;            /* 0x538 */
+    volatile uint32 SRACMP;           /* 0x53C */
+    volatile uint32 SRPWM;            /* 0x540 */
+    volatile uint32 SRQEI;            /* 0x544 */
+    uint32          RESERVED22[4];    /* 0x548 - 0x554 */
+    volatile uint32 SREEPROM;         /* 0x558 */
+    volatile uint32 SRWTIMER;         /* 0x55C */
+    uint32          RESERVED23[40];   /* 0x560 - 0x5FC */
+    volatile uint32 RCGCWD;           /* 0x600 */
+    volatile uint32 RCGCTIMER;        /* 0x604 */
+    volatile uint32 RCGCGPIO;         /* 0x608 */
+    volatile uint32 RCGCDMA;          /* 0x60C */
+    uint32          RESERVED24[1];    /* 0x610 */
+    volatile uint32 RCGCHIB;          /* 0x614 */
+    volatile uint32 RCGCUART;         /* 0x618 */
+    volatile uint32 RCGCSSI;          /* 0x61C */
+    volatile uint32 RCGCI2C;          /* 0x620 */
+    uint32          RESERVED25[1];    /* 0x624 */
+    volatile uint32 RCGCUSB;          /* 0x628 */
+    uint32          RESERVED26[2];    /* 0x62C - 0x630 */
+    volatile uint32 RCGCCAN;          /* 0x634 */
+    volatile uint32 RCGCADC;          /* 0x638 */
+    volatile uint32 RCGCACMP;         /* 0x63C */
+    volatile uint32 RCGCPWM;          /* 0x640 */
+    volatile uint32 RCGCQEI;          /* 0x644 */
+    uint32          RESERVED27[4];    /* 0x648 - 0x654 */
+    volatile uint32 RCGCEEPROM;       /* 0x658 */
+    volatile uint32 RCGCWTIMER;       /* 0x65C */
+    uint32          RESERVED28[40];   /* 0x660 - 0x6FC */
+    volatile uint32 SCGCWD;           /* 0x700 */
+    volatile uint32 SCGCTIMER;        /* 0x704 */
+    volatile uint32 SCGCGPIO;         /* 0x708 */
+    volatile uint32 SCGCDMA;          /* 0x70C */
+    uint32          RESERVED29[1];    /* 0x710 */
+    volatile uint32 SCGCHIB;          /* 0x714 */
+    volatile uint32 SCGCUART;         /* 0x718 */
+    volatile uint32 SCGCSSI;          /* 0x71C */
+    volatile uint32 SCGCI2C;          /* 0x720 */
+    uint32          RESERVED30[1];    /* 0x724 */
+    volatile uint32 SCGCUSB;          /* 0x728 */
+    uint32          RESERVED31[2];    /* 0x72C - 0x730 */
+    volatile uint32 SCGCCAN;          /* 0x734 */
+    volatile uint32 SCGCADC;          /* 0x738 */
+    volatile uint32 SCGCACMP;         /* 0x73C */
+    volatile uint32 SCGCPWM;          /* 0x740 */
+    volatile uint32 SCGCQEI;          /* 0x744 */
+    uint32          RESERVED32[4];    /* 0x748 - 0x754 */
+    volatile uint32 SCGCEEPROM;       /* 0x758 */
+    volatile uint32 SCGCWTIMER;       /* 0x75C */
+    uint32          RESERVED33[40];   /* 0x760 - 0x7FC */
+    volatile uint32 DCGCWD;           /* 0x800 */
+    volatile uint32 DCGCTIMER;        /* 0x804 */
+    volatile uint32 DCGCGPIO;         /* 0x808 */
+    volatile uint32 DCGCDMA;          /* 0x80C */
+    uint32          RESERVED34[1];    /* 0x810 */
+    volatile uint32 DCGCHIB;          /* 0x814 */
+    volatile uint32 DCGCUART;         /* 0x818 */
+    volatile uint32 DCGCSSI;          /* 0x81C */
+    volatile uint32 DCGCI2C;          /* 0x820 */
+    uint32          RESERVED35[1];    /* 0x824 */
+    volatile uint32 DCGCUSB;          /* 0x828 */
+    uint32          RESERVED36[2];    /* 0x82C - 0x830 */
+    volatile uint32 DCGCCAN;          /* 0x834 */
+    volatile uint32 DCGCADC;          /* 0x838 */
+    volatile uint32 DCGCACMP;         /* 0x83C */
+    volatile uint32 DCGCPWM;          /* 0x840 */
+    volatile uint32 DCGCQEI;          /* 0x844 */
+    uint32          RESERVED37[4];    /* 0x848 - 0x854 */
+    volatile uint32 DCGCEEPROM;       /* 0x858 */
+    volatile uint32 DCGCWTIMER;       /* 0x85C */
+    uint32          RESERVED38[104];  /* 0x860 - 0x9FC */
+    volatile uint32 PRWD;             /* 0xA00 */
+    volatile uint32 PRTIMER;          /* 0xA04 */
+    volatile uint32 PRGPIO;           /* 0xA08 */
+    volatile uint32 PRDMA;            /* 0xA0C */
+    uint32          RESERVED39[1];    /* 0xA10 */
+    volatile uint32 PRHIB;            /* 0xA14 */
+    volatile uint32 PRUART;           /* 0xA18 */
+    volatile uint32 PRSSI;            /* 0xA1C */
+    volatile uint32 PRI2C;            /* 0xA20 */
+    uint32          RESERVED40[1];    /* 0xA24 */
+    volatile uint32 PRUSB;            /* 0xA28 */
+    uint32          RESERVED41[2];    /* 0xA2C - 0xA30 */
+    volatile uint32 PRCAN;            /* 0xA34 */
+    volatile uint32 PRADC;            /* 0xA38 */
+    volatile uint32 PRACMP;           /* 0xA3C */
+    volatile uint32 PRPWM;            /* 0xA40 */
+    volatile uint32 PRQEI;            /* 0xA44 */
+    uint32          RESERVED42[4];    /* 0xA48 - 0xA54 */
+    volatile uint32 PREEPROM;         /* 0xA58 */
+    volatile uint32 PRWTIMER;         /* 0xA5C */
+}SYSCTL_RegType;
+
+#define SYSCTL_BASE               0x400FE000
+#define SYSCTL                    ((SYSCTL_RegType *)SYSCTL_BASE)
+
+/*****************************************************************************
+Compile-time checks of the structures above: every member is checked against
+the address of its *_REG definition (the typedef is named after it), or its
+documented offset when there is none. A wrong offset makes the array size
+negative and stops the build.
+*****************************************************************************/
+#define REGISTERS_CHECK(NAME, CONDITION)   typedef char REGISTERS_CHECK_##NAME[(CONDITION) ? 1 : -1]
+#define REGISTERS_AT(BASE, TYPE, MEMBER)   ((uint32)(BASE) + (uint32)offsetof(TYPE, MEMBER))
+
+REGISTERS_CHECK(GPIO_RegType_DATA_BITS, offsetof(GPIO_RegType, DATA_BITS) == 0x000u);
+REGISTERS_CHECK(GPIO_PORTA_DATA_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, DATA) == 0x400043FCu);
+REGISTERS_CHECK(GPIO_PORTA_DIR_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, DIR) == 0x40004400u);
+REGISTERS_CHECK(GPIO_PORTA_IS_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, IS) == 0x40004404u);
+REGISTERS_CHECK(GPIO_PORTA_IBE_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, IBE) == 0x40004408u);
+REGISTERS_CHECK(GPIO_PORTA_IEV_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, IEV) == 0x4000440Cu);
+REGISTERS_CHECK(GPIO_PORTA_IM_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, IM) == 0x40004410u);
+REGISTERS_CHECK(GPIO_PORTA_RIS_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, RIS) == 0x40004414u);
+REGISTERS_CHECK(GPIO_RegType_MIS, offsetof(GPIO_RegType, MIS) == 0x418u);
+REGISTERS_CHECK(GPIO_PORTA_ICR_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, ICR) == 0x4000441Cu);
+REGISTERS_CHECK(GPIO_PORTA_AFSEL_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, AFSEL) == 0x40004420u);
+REGISTERS_CHECK(GPIO_RegType_DR2R, offsetof(GPIO_RegType, DR2R) == 0x500u);
+REGISTERS_CHECK(GPIO_RegType_DR4R, offsetof(GPIO_RegType, DR4R) == 0x504u);
+REGISTERS_CHECK(GPIO_RegType_DR8R, offsetof(GPIO_RegType, DR8R) == 0x508u);
+REGISTERS_CHECK(GPIO_RegType_ODR, offsetof(GPIO_RegType, ODR) == 0x50Cu);
+REGISTERS_CHECK(GPIO_PORTA_PUR_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, PUR) == 0x40004510u);
+REGISTERS_CHECK(GPIO_PORTA_PDR_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, PDR) == 0x40004514u);
+REGISTERS_CHECK(GPIO_RegType_SLR, offsetof(GPIO_RegType, SLR) == 0x518u);
+REGISTERS_CHECK(GPIO_PORTA_DEN_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, DEN) == 0x4000451Cu);
+REGISTERS_CHECK(GPIO_PORTA_LOCK_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, LOCK) == 0x40004520u);
+REGISTERS_CHECK(GPIO_PORTA_CR_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, CR) == 0x40004524u);
+REGISTERS_CHECK(GPIO_PORTA_AMSEL_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, AMSEL) == 0x40004528u);
+REGISTERS_CHECK(GPIO_PORTA_PCTL_REG, REGISTERS_AT(GPIO_PORTA_BASE, GPIO_RegType, PCTL) == 0x4000452Cu);
+REGISTERS_CHECK(GPIO_RegType_ADCCTL, offsetof(GPIO_RegType, ADCCTL) == 0x530u);
+REGISTERS_CHECK(GPIO_RegType_DMACTL, offsetof(GPIO_RegType, DMACTL) == 0x534u);
+
+REGISTERS_CHECK(UART0_DR_REG, REGISTERS_AT(UART0_BASE, UART_RegType, DR) == 0x4000C000u);
+REGISTERS_CHECK(UART0_RSR_REG, REGISTERS_AT(UART0_BASE, UART_RegType, RSR_ECR) == 0x4000C004u);
+REGISTERS_CHECK(UART0_FR_REG, REGISTERS_AT(UART0_BASE, UART_RegType, FR) == 0x4000C018u);
+REGISTERS_CHECK(UART0_ILPR_REG, REGISTERS_AT(UART0_BASE, UART_RegType, ILPR) == 0x4000C020u);
+REGISTERS_CHECK(UART0_IBRD_REG, REGISTERS_AT(UART0_BASE, UART_RegType, IBRD) == 0x4000C024u);
+REGISTERS_CHECK(UART0_FBRD_REG, REGISTERS_AT(UART0_BASE, UART_RegType, FBRD) == 0x4000C028u);
+REGISTERS_CHECK(UART0_LCRH_REG, REGISTERS_AT(UART0_BASE, UART_RegType, LCRH) == 0x4000C02Cu);
+REGISTERS_CHECK(UART0_CTL_REG, REGISTERS_AT(UART0_BASE, UART_RegType, CTL) == 0x4000C030u);
+REGISTERS_CHECK(UART0_IFLS_REG, REGISTERS_AT(UART0_BASE, UART_RegType, IFLS) == 0x4000C034u);
+REGISTERS_CHECK(UART0_IM_REG, REGISTERS_AT(UART0_BASE, UART_RegType, IM) == 0x4000C038u);
+REGISTERS_CHECK(UART0_RIS_REG, REGISTERS_AT(UART0_BASE, UART_RegType, RIS) == 0x4000C03Cu);
+REGISTERS_CHECK(UART0_MIS_REG, REGISTERS_AT(UART0_BASE, UART_RegType, MIS) == 0x4000C040u);
+REGISTERS_CHECK(UART0_ICR_REG, REGISTERS_AT(UART0_BASE, UART_RegType, ICR) == 0x4000C044u);
+REGISTERS_CHECK(UART0_DMACTL_REG, REGISTERS_AT(UART0_BASE, UART_RegType, DMACTL) == 0x4000C048u);
+REGISTERS_CHECK(UART0_9BITADDR_REG, REGISTERS_AT(UART0_BASE, UART_RegType, BIT9ADDR) == 0x4000C0A4u);
+REGISTERS_CHECK(UART0_9BITAMASK_REG, REGISTERS_AT(UART0_BASE, UART_RegType, BIT9AMASK) == 0x4000C0A8u);
+REGISTERS_CHECK(UART0_PP_REG, REGISTERS_AT(UART0_BASE, UART_RegType, PP) == 0x4000CFC0u);
+REGISTERS_CHECK(UART0_CC_REG, REGISTERS_AT(UART0_BASE, UART_RegType, CC) == 0x4000CFC8u);
+
+REGISTERS_CHECK(UDMA_STAT_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, STAT) == 0x400FF000u);
+REGISTERS_CHECK(UDMA_CFG_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CFG) == 0x400FF004u);
+REGISTERS_CHECK(UDMA_CTLBASE_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CTLBASE) == 0x400FF008u);
+REGISTERS_CHECK(UDMA_ALTBASE_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, ALTBASE) == 0x400FF00Cu);
+REGISTERS_CHECK(UDMA_WAITSTAT_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, WAITSTAT) == 0x400FF010u);
+REGISTERS_CHECK(UDMA_SWREQ_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, SWREQ) == 0x400FF014u);
+REGISTERS_CHECK(UDMA_USEBURSTSET_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, USEBURSTSET) == 0x400FF018u);
+REGISTERS_CHECK(UDMA_USEBURSTCLR_R, REGISTERS_AT(UDMA_BASE, UDMA_RegType, USEBURSTCLR) == 0x400FF01Cu);
+REGISTERS_CHECK(UDMA_REQMASKSET_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, REQMASKSET) == 0x400FF020u);
+REGISTERS_CHECK(UDMA_REQMASKCLR_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, REQMASKCLR) == 0x400FF024u);
+REGISTERS_CHECK(UDMA_ENASET_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, ENASET) == 0x400FF028u);
+REGISTERS_CHECK(UDMA_ENACLR_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, ENACLR) == 0x400FF02Cu);
+REGISTERS_CHECK(UDMA_ALTSET_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, ALTSET) == 0x400FF030u);
+REGISTERS_CHECK(UDMA_ALTCLR_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, ALTCLR) == 0x400FF034u);
+REGISTERS_CHECK(UDMA_PRIOSET_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, PRIOSET) == 0x400FF038u);
+REGISTERS_CHECK(UDMA_PRIOCLR_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, PRIOCLR) == 0x400FF03Cu);
+REGISTERS_CHECK(UDMA_ERRCLR_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, ERRCLR) == 0x400FF04Cu);
+REGISTERS_CHECK(UDMA_CHASGN_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CHASGN) == 0x400FF500u);
+REGISTERS_CHECK(UDMA_CHIS_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CHIS) == 0x400FF504u);
+REGISTERS_CHECK(UDMA_CHMAP0_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CHMAP0) == 0x400FF510u);
+REGISTERS_CHECK(UDMA_CHMAP1_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CHMAP1) == 0x400FF514u);
+REGISTERS_CHECK(UDMA_CHMAP2_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CHMAP2) == 0x400FF518u);
+REGISTERS_CHECK(UDMA_CHMAP3_REG, REGISTERS_AT(UDMA_BASE, UDMA_RegType, CHMAP3) == 0x400FF51Cu);
+
+REGISTERS_CHECK(UDMA_ControlEntryType_SRCENDP, offsetof(UDMA_ControlEntryType, SRCENDP) == 0x000u);
+REGISTERS_CHECK(UDMA_ControlEntryType_DSTENDP, offsetof(UDMA_ControlEntryType, DSTENDP) == 0x004u);
+REGISTERS_CHECK(UDMA_ControlEntryType_CHCTL, offsetof(UDMA_ControlEntryType, CHCTL) == 0x008u);
+
+REGISTERS_CHECK(SYSTICK_CTRL_REG, REGISTERS_AT(SYSTICK_BASE, SYSTICK_RegType, CTRL) == 0xE000E010u);
+REGISTERS_CHECK(SYSTICK_RELOAD_REG, REGISTERS_AT(SYSTICK_BASE, SYSTICK_RegType, RELOAD) == 0xE000E014u);
+REGISTERS_CHECK(SYSTICK_CURRENT_REG, REGISTERS_AT(SYSTICK_BASE, SYSTICK_RegType, CURRENT) == 0xE000E018u);
+
+REGISTERS_CHECK(NVIC_EN0_REG, REGISTERS_AT(NVIC_BASE, NVIC_RegType, EN[0]) == 0xE000E100u);
+REGISTERS_CHECK(NVIC_DIS0_REG, REGISTERS_AT(NVIC_BASE, NVIC_RegType, DIS[0]) == 0xE000E180u);
+REGISTERS_CHECK(NVIC_RegType_PEND, offsetof(NVIC_RegType, PEND) == 0x100u);
+REGISTERS_CHECK(NVIC_RegType_UNPEND, offsetof(NVIC_RegType, UNPEND) == 0x180u);
+REGISTERS_CHECK(NVIC_RegType_ACTIVE, offsetof(NVIC_RegType, ACTIVE) == 0x200u);
+REGISTERS_CHECK(NVIC_PRI0_REG, REGISTERS_AT(NVIC_BASE, NVIC_RegType, PRI[0]) == 0xE000E400u);
+REGISTERS_CHECK(NVIC_RegType_SWTRIG, offsetof(NVIC_RegType, SWTRIG) == 0xE00u);
+
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_CPUID, offsetof(NVIC_SYSTEM_RegType, CPUID) == 0x000u);
+REGISTERS_CHECK(NVIC_SYSTEM_INTCTRL, REGISTERS_AT(NVIC_SYSTEM_BASE, NVIC_SYSTEM_RegType, INTCTRL) == 0xE000ED04u);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_VTABLE, offsetof(NVIC_SYSTEM_RegType, VTABLE) == 0x008u);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_APINT, offsetof(NVIC_SYSTEM_RegType, APINT) == 0x00Cu);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_SYSCTRL, offsetof(NVIC_SYSTEM_RegType, SYSCTRL) == 0x010u);
+REGISTERS_CHECK(NVIC_SYSTEM_CFGCTRL, REGISTERS_AT(NVIC_SYSTEM_BASE, NVIC_SYSTEM_RegType, CFGCTRL) == 0xE000ED14u);
+REGISTERS_CHECK(NVIC_SYSTEM_PRI1_REG, REGISTERS_AT(NVIC_SYSTEM_BASE, NVIC_SYSTEM_RegType, PRI1) == 0xE000ED18u);
+REGISTERS_CHECK(NVIC_SYSTEM_PRI2_REG, REGISTERS_AT(NVIC_SYSTEM_BASE, NVIC_SYSTEM_RegType, PRI2) == 0xE000ED1Cu);
+REGISTERS_CHECK(NVIC_SYSTEM_PRI3_REG, REGISTERS_AT(NVIC_SYSTEM_BASE, NVIC_SYSTEM_RegType, PRI3) == 0xE000ED20u);
+REGISTERS_CHECK(NVIC_SYSTEM_SYSHNDCTRL, REGISTERS_AT(NVIC_SYSTEM_BASE, NVIC_SYSTEM_RegType, SYSHNDCTRL) == 0xE000ED24u);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_FAULTSTAT, offsetof(NVIC_SYSTEM_RegType, FAULTSTAT) == 0x028u);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_HFAULTSTAT, offsetof(NVIC_SYSTEM_RegType, HFAULTSTAT) == 0x02Cu);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_DEBUGSTAT, offsetof(NVIC_SYSTEM_RegType, DEBUGSTAT) == 0x030u);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_MMADDR, offsetof(NVIC_SYSTEM_RegType, MMADDR) == 0x034u);
+REGISTERS_CHECK(NVIC_SYSTEM_RegType_FAULTADDR, offsetof(NVIC_SYSTEM_RegType, FAULTADDR) == 0x038u);
+
+REGISTERS_CHECK(SYSCTL_DID0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DID0) == 0x400FE000u);
+REGISTERS_CHECK(SYSCTL_DID1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DID1) == 0x400FE004u);
+REGISTERS_CHECK(SYSCTL_DC0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC0) == 0x400FE008u);
+REGISTERS_CHECK(SYSCTL_DC1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC1) == 0x400FE010u);
+REGISTERS_CHECK(SYSCTL_DC2_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC2) == 0x400FE014u);
+REGISTERS_CHECK(SYSCTL_DC3_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC3) == 0x400FE018u);
+REGISTERS_CHECK(SYSCTL_DC4_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC4) == 0x400FE01Cu);
+REGISTERS_CHECK(SYSCTL_DC5_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC5) == 0x400FE020u);
+REGISTERS_CHECK(SYSCTL_DC6_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC6) == 0x400FE024u);
+REGISTERS_CHECK(SYSCTL_DC7_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC7) == 0x400FE028u);
+REGISTERS_CHECK(SYSCTL_DC8_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC8) == 0x400FE02Cu);
+REGISTERS_CHECK(SYSCTL_PBORCTL_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PBORCTL) == 0x400FE030u);
+REGISTERS_CHECK(SYSCTL_SRCR0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRCR0) == 0x400FE040u);
+REGISTERS_CHECK(SYSCTL_SRCR1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRCR1) == 0x400FE044u);
+REGISTERS_CHECK(SYSCTL_SRCR2_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRCR2) == 0x400FE048u);
+REGISTERS_CHECK(SYSCTL_RIS_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RIS) == 0x400FE050u);
+REGISTERS_CHECK(SYSCTL_IMC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, IMC) == 0x400FE054u);
+REGISTERS_CHECK(SYSCTL_MISC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, MISC) == 0x400FE058u);
+REGISTERS_CHECK(SYSCTL_RESC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RESC) == 0x400FE05Cu);
+REGISTERS_CHECK(SYSCTL_RCC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCC) == 0x400FE060u);
+REGISTERS_CHECK(SYSCTL_GPIOHBCTL_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, GPIOHBCTL) == 0x400FE06Cu);
+REGISTERS_CHECK(SYSCTL_RCC2_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCC2) == 0x400FE070u);
+REGISTERS_CHECK(SYSCTL_MOSCCTL_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, MOSCCTL) == 0x400FE07Cu);
+REGISTERS_CHECK(SYSCTL_RCGC0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGC0) == 0x400FE100u);
+REGISTERS_CHECK(SYSCTL_RCGC1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGC1) == 0x400FE104u);
+REGISTERS_CHECK(SYSCTL_RCGC2_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGC2) == 0x400FE108u);
+REGISTERS_CHECK(SYSCTL_SCGC0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGC0) == 0x400FE110u);
+REGISTERS_CHECK(SYSCTL_SCGC1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGC1) == 0x400FE114u);
+REGISTERS_CHECK(SYSCTL_SCGC2_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGC2) == 0x400FE118u);
+REGISTERS_CHECK(SYSCTL_DCGC0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGC0) == 0x400FE120u);
+REGISTERS_CHECK(SYSCTL_DCGC1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGC1) == 0x400FE124u);
+REGISTERS_CHECK(SYSCTL_DCGC2_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGC2) == 0x400FE128u);
+REGISTERS_CHECK(SYSCTL_DSLPCLKCFG_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DSLPCLKCFG) == 0x400FE144u);
+REGISTERS_CHECK(SYSCTL_SYSPROP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SYSPROP) == 0x400FE14Cu);
+REGISTERS_CHECK(SYSCTL_PIOSCCAL_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PIOSCCAL) == 0x400FE150u);
+REGISTERS_CHECK(SYSCTL_PIOSCSTAT_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PIOSCSTAT) == 0x400FE154u);
+REGISTERS_CHECK(SYSCTL_PLLFREQ0_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PLLFREQ0) == 0x400FE160u);
+REGISTERS_CHECK(SYSCTL_PLLFREQ1_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PLLFREQ1) == 0x400FE164u);
+REGISTERS_CHECK(SYSCTL_PLLSTAT_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PLLSTAT) == 0x400FE168u);
+REGISTERS_CHECK(SYSCTL_DC9_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DC9) == 0x400FE190u);
+REGISTERS_CHECK(SYSCTL_NVMSTAT_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, NVMSTAT) == 0x400FE1A0u);
+REGISTERS_CHECK(SYSCTL_PPWD_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPWD) == 0x400FE300u);
+REGISTERS_CHECK(SYSCTL_PPTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPTIMER) == 0x400FE304u);
+REGISTERS_CHECK(SYSCTL_PPGPIO_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPGPIO) == 0x400FE308u);
+REGISTERS_CHECK(SYSCTL_PPDMA_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPDMA) == 0x400FE30Cu);
+REGISTERS_CHECK(SYSCTL_PPHIB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPHIB) == 0x400FE314u);
+REGISTERS_CHECK(SYSCTL_PPUART_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPUART) == 0x400FE318u);
+REGISTERS_CHECK(SYSCTL_PPSSI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPSSI) == 0x400FE31Cu);
+REGISTERS_CHECK(SYSCTL_PPI2C_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPI2C) == 0x400FE320u);
+REGISTERS_CHECK(SYSCTL_PPUSB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPUSB) == 0x400FE328u);
+REGISTERS_CHECK(SYSCTL_PPCAN_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPCAN) == 0x400FE334u);
+REGISTERS_CHECK(SYSCTL_PPADC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPADC) == 0x400FE338u);
+REGISTERS_CHECK(SYSCTL_PPACMP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPACMP) == 0x400FE33Cu);
+REGISTERS_CHECK(SYSCTL_PPPWM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPPWM) == 0x400FE340u);
+REGISTERS_CHECK(SYSCTL_PPQEI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPQEI) == 0x400FE344u);
+REGISTERS_CHECK(SYSCTL_PPEEPROM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPEEPROM) == 0x400FE358u);
+REGISTERS_CHECK(SYSCTL_PPWTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PPWTIMER) == 0x400FE35Cu);
+REGISTERS_CHECK(SYSCTL_SRWD_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRWD) == 0x400FE500u);
+REGISTERS_CHECK(SYSCTL_SRTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRTIMER) == 0x400FE504u);
+REGISTERS_CHECK(SYSCTL_SRGPIO_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRGPIO) == 0x400FE508u);
+REGISTERS_CHECK(SYSCTL_SRDMA_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRDMA) == 0x400FE50Cu);
+REGISTERS_CHECK(SYSCTL_SRHIB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRHIB) == 0x400FE514u);
+REGISTERS_CHECK(SYSCTL_SRUART_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRUART) == 0x400FE518u);
+REGISTERS_CHECK(SYSCTL_SRSSI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRSSI) == 0x400FE51Cu);
+REGISTERS_CHECK(SYSCTL_SRI2C_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRI2C) == 0x400FE520u);
+REGISTERS_CHECK(SYSCTL_SRUSB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRUSB) == 0x400FE528u);
+REGISTERS_CHECK(SYSCTL_SRCAN_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRCAN) == 0x400FE534u);
+REGISTERS_CHECK(SYSCTL_SRADC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRADC) == 0x400FE538u);
+REGISTERS_CHECK(SYSCTL_SRACMP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRACMP) == 0x400FE53Cu);
+REGISTERS_CHECK(SYSCTL_SRPWM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRPWM) == 0x400FE540u);
+REGISTERS_CHECK(SYSCTL_SRQEI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRQEI) == 0x400FE544u);
+REGISTERS_CHECK(SYSCTL_SREEPROM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SREEPROM) == 0x400FE558u);
+REGISTERS_CHECK(SYSCTL_SRWTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SRWTIMER) == 0x400FE55Cu);
+REGISTERS_CHECK(SYSCTL_RCGCWD_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCWD) == 0x400FE600u);
+REGISTERS_CHECK(SYSCTL_RCGCTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCTIMER) == 0x400FE604u);
+REGISTERS_CHECK(SYSCTL_RCGCGPIO_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCGPIO) == 0x400FE608u);
+REGISTERS_CHECK(SYSCTL_RCGCDMA_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCDMA) == 0x400FE60Cu);
+REGISTERS_CHECK(SYSCTL_RCGCHIB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCHIB) == 0x400FE614u);
+REGISTERS_CHECK(SYSCTL_RCGCUART_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCUART) == 0x400FE618u);
+REGISTERS_CHECK(SYSCTL_RCGCSSI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCSSI) == 0x400FE61Cu);
+REGISTERS_CHECK(SYSCTL_RCGCI2C_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCI2C) == 0x400FE620u);
+REGISTERS_CHECK(SYSCTL_RCGCUSB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCUSB) == 0x400FE628u);
+REGISTERS_CHECK(SYSCTL_RCGCCAN_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCCAN) == 0x400FE634u);
+REGISTERS_CHECK(SYSCTL_RCGCADC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCADC) == 0x400FE638u);
+REGISTERS_CHECK(SYSCTL_RCGCACMP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCACMP) == 0x400FE63Cu);
+REGISTERS_CHECK(SYSCTL_RCGCPWM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCPWM) == 0x400FE640u);
+REGISTERS_CHECK(SYSCTL_RCGCQEI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCQEI) == 0x400FE644u);
+REGISTERS_CHECK(SYSCTL_RCGCEEPROM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCEEPROM) == 0x400FE658u);
+REGISTERS_CHECK(SYSCTL_RCGCWTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, RCGCWTIMER) == 0x400FE65Cu);
+REGISTERS_CHECK(SYSCTL_SCGCWD_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCWD) == 0x400FE700u);
+REGISTERS_CHECK(SYSCTL_SCGCTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCTIMER) == 0x400FE704u);
+REGISTERS_CHECK(SYSCTL_SCGCGPIO_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCGPIO) == 0x400FE708u);
+REGISTERS_CHECK(SYSCTL_SCGCDMA_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCDMA) == 0x400FE70Cu);
+REGISTERS_CHECK(SYSCTL_SCGCHIB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCHIB) == 0x400FE714u);
+REGISTERS_CHECK(SYSCTL_SCGCUART_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCUART) == 0x400FE718u);
+REGISTERS_CHECK(SYSCTL_SCGCSSI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCSSI) == 0x400FE71Cu);
+REGISTERS_CHECK(SYSCTL_SCGCI2C_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCI2C) == 0x400FE720u);
+REGISTERS_CHECK(SYSCTL_SCGCUSB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCUSB) == 0x400FE728u);
+REGISTERS_CHECK(SYSCTL_SCGCCAN_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCCAN) == 0x400FE734u);
+REGISTERS_CHECK(SYSCTL_SCGCADC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCADC) == 0x400FE738u);
+REGISTERS_CHECK(SYSCTL_SCGCACMP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCACMP) == 0x400FE73Cu);
+REGISTERS_CHECK(SYSCTL_SCGCPWM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCPWM) == 0x400FE740u);
+REGISTERS_CHECK(SYSCTL_SCGCQEI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCQEI) == 0x400FE744u);
+REGISTERS_CHECK(SYSCTL_SCGCEEPROM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCEEPROM) == 0x400FE758u);
+REGISTERS_CHECK(SYSCTL_SCGCWTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, SCGCWTIMER) == 0x400FE75Cu);
+REGISTERS_CHECK(SYSCTL_DCGCWD_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCWD) == 0x400FE800u);
+REGISTERS_CHECK(SYSCTL_DCGCTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCTIMER) == 0x400FE804u);
+REGISTERS_CHECK(SYSCTL_DCGCGPIO_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCGPIO) == 0x400FE808u);
+REGISTERS_CHECK(SYSCTL_DCGCDMA_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCDMA) == 0x400FE80Cu);
+REGISTERS_CHECK(SYSCTL_DCGCHIB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCHIB) == 0x400FE814u);
+REGISTERS_CHECK(SYSCTL_DCGCUART_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCUART) == 0x400FE818u);
+REGISTERS_CHECK(SYSCTL_DCGCSSI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCSSI) == 0x400FE81Cu);
+REGISTERS_CHECK(SYSCTL_DCGCI2C_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCI2C) == 0x400FE820u);
+REGISTERS_CHECK(SYSCTL_DCGCUSB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCUSB) == 0x400FE828u);
+REGISTERS_CHECK(SYSCTL_DCGCCAN_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCCAN) == 0x400FE834u);
+REGISTERS_CHECK(SYSCTL_DCGCADC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCADC) == 0x400FE838u);
+REGISTERS_CHECK(SYSCTL_DCGCACMP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCACMP) == 0x400FE83Cu);
+REGISTERS_CHECK(SYSCTL_DCGCPWM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCPWM) == 0x400FE840u);
+REGISTERS_CHECK(SYSCTL_DCGCQEI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCQEI) == 0x400FE844u);
+REGISTERS_CHECK(SYSCTL_DCGCEEPROM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCEEPROM) == 0x400FE858u);
+REGISTERS_CHECK(SYSCTL_DCGCWTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, DCGCWTIMER) == 0x400FE85Cu);
+REGISTERS_CHECK(SYSCTL_PRWD_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRWD) == 0x400FEA00u);
+REGISTERS_CHECK(SYSCTL_PRTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRTIMER) == 0x400FEA04u);
+REGISTERS_CHECK(SYSCTL_PRGPIO_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRGPIO) == 0x400FEA08u);
+REGISTERS_CHECK(SYSCTL_PRDMA_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRDMA) == 0x400FEA0Cu);
+REGISTERS_CHECK(SYSCTL_PRHIB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRHIB) == 0x400FEA14u);
+REGISTERS_CHECK(SYSCTL_PRUART_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRUART) == 0x400FEA18u);
+REGISTERS_CHECK(SYSCTL_PRSSI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRSSI) == 0x400FEA1Cu);
+REGISTERS_CHECK(SYSCTL_PRI2C_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRI2C) == 0x400FEA20u);
+REGISTERS_CHECK(SYSCTL_PRUSB_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRUSB) == 0x400FEA28u);
+REGISTERS_CHECK(SYSCTL_PRCAN_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRCAN) == 0x400FEA34u);
+REGISTERS_CHECK(SYSCTL_PRADC_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRADC) == 0x400FEA38u);
+REGISTERS_CHECK(SYSCTL_PRACMP_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRACMP) == 0x400FEA3Cu);
+REGISTERS_CHECK(SYSCTL_PRPWM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRPWM) == 0x400FEA40u);
+REGISTERS_CHECK(SYSCTL_PRQEI_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRQEI) == 0x400FEA44u);
+REGISTERS_CHECK(SYSCTL_PREEPROM_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PREEPROM) == 0x400FEA58u);
+REGISTERS_CHECK(SYSCTL_PRWTIMER_REG, REGISTERS_AT(SYSCTL_BASE, SYSCTL_RegType, PRWTIMER) == 0x400FEA5Cu);
+
 #endif
@@ -0,0 +1,61 @@
+#!/bin/sh
+#
+# Register access disassembly benchmark.
+#
+# Builds regaccess_macro.c (C register macros) and regaccess_template.cpp
+# (C++ register layer) for the Cortex-M4F, then compares the number of
+# instructions of every bench_<name> function with its bench_<name>_tpl
+# counterpart and prints both disassemblies side by side on a mismatch.
+# Fails if any template version is longer than the macro version.
+#
+# Both versions of a sequence do the same register accesses, so the counts
+# only compare the code the two layers make the compiler emit.
+#
+# The project is built with TI armcl, this script defaults to GNU Arm: the
+# counts show what each layer costs in GCC and may differ from the armcl
+# output. The result header names the compiler that produced it.
+#
+# Usage: ./compare.sh [-v]
+#   CC, CXX, OBJDUMP  toolchain (default arm-none-eabi-*)
+#   CFLAGS            target and optimization flags
+#
+
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+APP="$HERE/../../Final_Project_ARM_APP1"
+CC=${CC:-arm-none-eabi-gcc}
+CXX=${CXX:-arm-none-eabi-g++}
+OBJDUMP=${OBJDUMP:-arm-none-eabi-objdump}
+CFLAGS=${CFLAGS:-"-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-sp-d16 -O2"}
+VERBOSE=$1
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+$CC  $CFLAGS -ffunction-sections -I"$APP" -c "$HERE/regaccess_macro.c" -o "$OUT/macro.o"
+$CXX $CFLAGS -std=c++11 -fno-exceptions -fno-rtti -ffunction-sections -I"$APP" -c "$HERE/regaccess_template.cpp" -o "$OUT/template.o"
+
+# disassemble one function: instruction lines only, addresses and encodings stripped
+disasm()
+{
+    $OBJDUMP -d --no-show-raw-insn "$1" \
+        | awk -v fn="<$2>:" '$2 == fn { on = 1; next } /^$/ { on = 0 } on && /^ *[0-9a-f]+:/ { sub(/^ *[0-9a-f]+:[ \t]*/, ""); print }'
+}
+
+status=0
+echo "compiler: $($CC --version 2>&1 | head -n 1)"
+printf "%-24s %8s %8s\n" "sequence" "macro" "template"
+for fn in $($OBJDUMP -t "$OUT/macro.o" | awk '$NF ~ /^bench_/ { print $NF }' | sort); do
+    disasm "$OUT/macro.o" "$fn" > "$OUT/$fn.macro"
+    disasm "$OUT/template.o" "${fn}_tpl" > "$OUT/$fn.tpl"
+    m=$(wc -l < "$OUT/$fn.macro")
+    t=$(wc -l < "$OUT/$fn.tpl")
+    mark=""
+    if [ "$t" -gt "$m" ]; then mark="  <-- larger"; status=1; fi
+    printf "%-24s %8d %8d%s\n" "$fn" "$m" "$t" "$mark"
+    if [ -n "$mark" ] || [ "$VERBOSE" = "-v" ]; then
+        diff -y -W 100 "$OUT/$fn.macro" "$OUT/$fn.tpl" || true
+    fi
+done
+
+exit $status
@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: Benchmarks - Register access
+ *
+ * File Name: regaccess_macro.c
+ *
+ * Description: Reference register sequences written with the C register macros.
+ *              Compared by compare.sh against the C++ versions of
+ *              regaccess_template.cpp, which do the same register accesses.
+ *
+ *******************************************************************************/
+
+#include "tm4c123gh6pm_registers.h"
+#include "NVIC.h"
+
+/* Masked data alias of PF1 - PF3: address bits 9:2 select the pins a store changes */
+#define GPIO_PORTF_LEDS_DATA_REG  (*((volatile uint32 *)(GPIO_PORTF_BASE + (0x0E << 2))))
+
+/* NVIC_SetPriorityException(EXCEPTION_SYSTICK_TYPE, 1) */
+void bench_systick_priority(void)
+{
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & ~SYSTICK_PRIORITY_MASK) | (1 << SYSTICK_PRIORITY_BITS_POS);
+}
+
+/* NVIC_EnableIRQ(30) and NVIC_SetPriorityIRQ(30, 2) with constant arguments */
+void bench_portf_irq(void)
+{
+    NVIC_EN0_REG = (1<<30);
+    NVIC_PRI7_REG = (NVIC_PRI7_REG & ~0x00E00000) | (2 << 21);
+}
+
+/* SysTick_StartBusyWait() control register update */
+void bench_systick_ctrl(void)
+{
+    SYSTICK_CTRL_REG = (SYSTICK_CTRL_REG & 0xFFFFFFF8) | 0x05;
+}
+
+/* SW2 (PF0) falling edge interrupt configuration. ICR is write-one-to-clear,
+ * both versions store the bit without reading the register first */
+void bench_sw2_edge(void)
+{
+    GPIO_PORTF_IS_REG    &= ~(1<<0);
+    GPIO_PORTF_IBE_REG   &= ~(1<<0);
+    GPIO_PORTF_IEV_REG   &= ~(1<<0);
+    GPIO_PORTF_ICR_REG    = (1<<0);
+    GPIO_PORTF_IM_REG    |= (1<<0);
+}
+
+/* Turn on the Red LED and disable the others, a single store through the
+ * masked data alias in both versions */
+void bench_led_red(void)
+{
+    GPIO_PORTF_LEDS_DATA_REG = 0x02;
+}
+
+/* Enable UART0 transmitter, receiver and the UART itself */
+void bench_uart_enable(void)
+{
+    UART0_CTL_REG |= (1<<0) | (1<<8) | (1<<9);
+}
+
+/* UDMA_AssignChannel(9, 0), UDMA_SetChannelAttributes(9, FALSE, FALSE) and
+ * UDMA_EnableChannel(9) for the UART0 TX channel. The set/clear registers are
+ * write-one-to-set/clear, only CHMAP1 needs a read-modify-write */
+void bench_udma_channel(void)
+{
+    UDMA_CHMAP1_REG = (UDMA_CHMAP1_REG & ~(0xF << 4)) | (0 << 4);
+    UDMA_PRIOCLR_REG = (1<<9);
+    UDMA_USEBURSTCLR_R = (1<<9);
+    UDMA_REQMASKCLR_REG = (1<<9);
+    UDMA_ALTCLR_REG = (1<<9);
+    UDMA_ENASET_REG = (1<<9);
+}
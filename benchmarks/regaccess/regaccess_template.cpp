@@ -0,0 +1,60 @@
+ /******************************************************************************
+ *
+ * Module: Benchmarks - Register access
+ *
+ * File Name: regaccess_template.cpp
+ *
+ * Description: The sequences of regaccess_macro.c written with the C++ register
+ *              layer of tm4c123gh6pm_registers.hpp.
+ *
+ *******************************************************************************/
+
+#include "tm4c123gh6pm_registers.hpp"
+
+using namespace tm4c;
+
+extern "C" void bench_systick_priority_tpl(void)
+{
+    SysPri3::modify< SysPri3::TICK::Value<1> >();
+}
+
+extern "C" void bench_portf_irq_tpl(void)
+{
+    Nvic::enableIrq<30>();
+    Nvic::setPriority<30, 2>();
+}
+
+extern "C" void bench_systick_ctrl_tpl(void)
+{
+    SysTickCtrl::modify< SysTickCtrl::ENABLE::Set, SysTickCtrl::INTEN::Clear, SysTickCtrl::CLK_SRC::Set >();
+}
+
+extern "C" void bench_sw2_edge_tpl(void)
+{
+    GpioF::IS::modify< Bit<GpioF::IS, 0>::Clear >();
+    GpioF::IBE::modify< Bit<GpioF::IBE, 0>::Clear >();
+    GpioF::IEV::modify< Bit<GpioF::IEV, 0>::Clear >();
+    GpioF::ICR::write(1u << 0);     /* write-one-to-clear, no read needed */
+    GpioF::IM::modify< Bit<GpioF::IM, 0>::Set >();
+}
+
+extern "C" void bench_led_red_tpl(void)
+{
+    /* masked data alias of PF1 - PF3: a single store, no read-modify-write */
+    GpioF::DataBits<0x0E>::write(0x02);
+}
+
+extern "C" void bench_uart_enable_tpl(void)
+{
+    Uart0::CTL::modify< Uart0::CTL::UARTEN::Set, Uart0::CTL::TXE::Set, Uart0::CTL::RXE::Set >();
+}
+
+extern "C" void bench_udma_channel_tpl(void)
+{
+    Udma::ChannelMap<9>::write<0>();
+    Udma::PRIOCLR::write(Udma::Channel<9>::mask);
+    Udma::USEBURSTCLR::write(Udma::Channel<9>::mask);
+    Udma::REQMASKCLR::write(Udma::Channel<9>::mask);
+    Udma::ALTCLR::write(Udma::Channel<9>::mask);
+    Udma::enableChannel<9>();
+}
@@ -0,0 +1,74 @@
+"""Minimal reader for little-endian ELF32 images (TI armcl and GNU ARM output).
+
+Only what the host tools need: section headers and the symbol table.
+"""
+
+import struct
+from collections import namedtuple
+
+Section = namedtuple("Section", "name type flags addr offset size link entsize")
+Symbol = namedtuple("Symbol", "name value size type bind shndx")
+
+SHT_SYMTAB = 2
+STT_OBJECT = 1
+STT_FUNC = 2
+
+
+class Elf32(object):
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError("%s: not a little-endian ELF32 file" % path)
+        (self.shoff,) = struct.unpack_from("<I", self.data, 0x20)
+        self.shentsize, self.shnum, self.shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+        self.sections = self._read_sections()
+
+    def _read_sections(self):
+        raw = []
+        for i in range(self.shnum):
+            raw.append(struct.unpack_from("<IIIIIIIIII", self.data, self.shoff + i * self.shentsize))
+        names = raw[self.shstrndx][4] if raw else 0
+        sections = []
+        for (name, type_, flags, addr, offset, size, link, _info, _align, entsize) in raw:
+            sections.append(Section(self._string(names, name), type_, flags, addr, offset, size, link, entsize))
+        return sections
+
+    def _string(self, table_offset, index):
+        start = table_offset + index
+        end = self.data.index(b"\0", start)
+        return self.data[start:end].decode("ascii", "replace")
+
+    def section(self, name):
+        for sec in self.sections:
+            if sec.name == name:
+                return sec
+        return None
+
+    def symbols(self):
+        """Yield every symbol of the symbol table, Thumb bit cleared for functions."""
+        for sec in self.sections:
+            if sec.type != SHT_SYMTAB:
+                continue
+            strtab = self.sections[sec.link].offset
+            for i in range(sec.size // sec.entsize):
+                name, value, size, info, _other, shndx = struct.unpack_from(
+                    "<IIIBBH", self.data, sec.offset + i * sec.entsize)
+                type_ = info & 0xF
+                if type_ == STT_FUNC:
+                    value &= ~1
+                yield Symbol(self._string(strtab, name), value, size, type_, info >> 4, shndx)
+
+    def functions(self):
+        """Sorted (address, size, name) of the sized function symbols."""
+        funcs = set()
+        for sym in self.symbols():
+            if sym.type == STT_FUNC and sym.size and sym.name:
+                funcs.add((sym.value, sym.size, sym.name))
+        return sorted(funcs)
+
+    def symbol(self, name):
+        for sym in self.symbols():
+            if sym.name == name:
+                return sym
+        return None
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Turn a PcSampler histogram into a function order for the linker.
+
+usage: layout_profile.py APP.out DUMP.bin [-o layout_profile.cmd] [--min-percent P]
+
+The histogram dump is read like pcsample_report.py does. Every function that
+has at least P percent of the samples is written as an input section line,
+hottest first, for the .text specification of tm4c123gh6pm.cmd. Compile and
+link with --define=LAYOUT_PROFILE=1 to use it: CODE_HOT is then empty and the
+compiler puts every function in its own .text:<name> subsection (the armcl
+default, --gen_func_subsections). Functions already placed by RAMFUNC or
+CODE_COLD do not match the lines and keep their place.
+
+To measure the gain, build twice with RAMFUNC_ENABLE=FALSE and
+LAYOUT_BENCHMARK=TRUE, without and with LAYOUT_PROFILE=1, and compare the
+"SysTick ISR path" line of the RTT log.
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elf32 import Elf32  # noqa: E402
+from pcsample_report import attribute, read_histogram, run_functions, warn_outside  # noqa: E402
+
+
+def hot_functions(elf_path, dump_path, min_percent):
+    ranges, shift, samples, outside = read_histogram(dump_path)
+    warn_outside(samples, outside)
+    weights = attribute(run_functions(Elf32(elf_path)), ranges, shift)
+    counted = float(sum(sum(buckets) for _base, buckets in ranges))
+    if not counted:
+        return []
+    ranked = sorted(weights.items(), key=lambda item: -item[1])
+    return [(name, 100.0 * hits / counted) for name, hits in ranked
+            if not name.startswith("<") and 100.0 * hits / counted >= min_percent]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("elf")
+    parser.add_argument("dump")
+    parser.add_argument("-o", "--output", default="layout_profile.cmd")
+    parser.add_argument("--min-percent", type=float, default=0.5)
+    args = parser.parse_args()
+
+    lines = ["/* Generated by tools/layout_profile.py from %s, do not edit */"
+             % os.path.basename(args.dump)]
+    for name, percent in hot_functions(args.elf, args.dump, args.min_percent):
+        lines.append("        *(.text:%s)    /* %5.2f%% */" % (name, percent))
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("%s: %d functions" % (args.output, len(lines) - 1))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Decode the deferred binary log stream of Log.c.
+
+usage: log_decode.py APP.out CAPTURE.bin
+
+CAPTURE.bin holds the bytes read from the binary RTT up channel (channel 1),
+for example with "JLinkRTTLogger -RTTChannel 1" or the RTT server of OpenOCD.
+Each statement is a header word, level (31:29), number of arguments (28:26)
+and string ID (23:0), followed by the argument words. The ID is the low 24
+bits of the format string address in the .logstr section of the ELF file.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elf32 import Elf32  # noqa: E402
+
+ID_MASK = 0x00FFFFFF
+LEVELS = {1: "ERROR", 2: "WARN", 3: "INFO", 4: "DEBUG"}
+CONVERSION = re.compile(r"%([-0 #+]*)(\d*)([duxXc%])")
+
+
+def load_strings(elf_path):
+    elf = Elf32(elf_path)
+    sec = elf.section(".logstr")
+    if sec is None:
+        raise SystemExit("%s: no .logstr section" % elf_path)
+    blob = elf.data[sec.offset:sec.offset + sec.size]
+    return (sec.addr & ID_MASK), blob
+
+
+def format_message(fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, width, kind = match.groups()
+        if kind == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if kind == "d":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            kind = "d"
+        elif kind == "u":
+            kind = "d"
+        elif kind == "c":
+            value = chr(value & 0xFF)
+        return ("%" + flags + width + kind) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(data, base, blob):
+    words = struct.unpack("<%dI" % (len(data) // 4), data[:len(data) & ~3])
+    pos = 0
+    while pos < len(words):
+        header = words[pos]
+        level = header >> 29
+        count = (header >> 26) & 0x7
+        offset = (header & ID_MASK) - base
+        args = words[pos + 1:pos + 1 + count]
+        pos += 1 + count
+        if not 0 <= offset < len(blob) or len(args) != count:
+            yield "?????: bad header 0x%08X" % header
+            continue
+        fmt = blob[offset:blob.index(b"\0", offset)].decode("ascii", "replace")
+        yield "%-5s: %s" % (LEVELS.get(level, "L%d" % level), format_message(fmt, args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("elf")
+    parser.add_argument("capture")
+    args = parser.parse_args()
+
+    base, blob = load_strings(args.elf)
+    with open(args.capture, "rb") as f:
+        data = f.read()
+    for line in decode(data, base, blob):
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Map a PcSampler histogram dump back to functions.
+
+usage: pcsample_report.py APP.out DUMP.bin [--top N]
+
+DUMP.bin is a raw memory dump that contains g_PcSampler_Histogram (for example
+saved from the debugger memory view). The histogram is located by its "PCSM"
+magic, the layout is PcSampler_HistogramType in PcSampler.h. A bucket that
+covers several functions is shared between them in proportion to the bytes
+each one has in the bucket. The RAMFUNC buckets hold SRAM run addresses, so a
+.ramfunc function whose symbol has its flash load address is moved by the
+__ramfunc_run_start - __ramfunc_load_start offset of the link.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elf32 import Elf32  # noqa: E402
+
+MAGIC = 0x4D534350
+HEADER = struct.Struct("<IIHHIIIHH")
+
+# Warn when more samples than this fall outside both sampled ranges
+OUTSIDE_WARN_PERCENT = 10.0
+
+
+def read_histogram(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    offset = data.find(struct.pack("<I", MAGIC))
+    if offset < 0:
+        raise SystemExit("%s: no PcSampler histogram found" % path)
+    (_magic, base, shift, count, samples, outside,
+     ram_base, ram_count, _reserved) = HEADER.unpack_from(data, offset)
+    buckets = struct.unpack_from("<%dH" % count, data, offset + HEADER.size)
+    ram_buckets = struct.unpack_from("<%dH" % ram_count, data, offset + HEADER.size + 2 * count)
+    ranges = [(base, buckets), (ram_base, ram_buckets)]
+    return ranges, shift, samples, outside
+
+
+def run_functions(elf):
+    """Functions of the image at the address they run from."""
+    load = elf.symbol("__ramfunc_load_start")
+    run = elf.symbol("__ramfunc_run_start")
+    size = elf.symbol("__ramfunc_size")
+    functions = elf.functions()
+    if load is None or run is None or size is None or load.value == run.value:
+        return functions
+    moved = []
+    for addr, length, name in functions:
+        if load.value <= addr < load.value + size.value:
+            addr += run.value - load.value
+        moved.append((addr, length, name))
+    return sorted(moved)
+
+
+def warn_outside(samples, outside):
+    if samples and 100.0 * outside / samples > OUTSIDE_WARN_PERCENT:
+        sys.stderr.write("warning: %.1f%% of the samples are outside the sampled ranges, "
+                         "the profile misses that code\n" % (100.0 * outside / samples))
+
+
+def attribute(functions, ranges, shift):
+    weights = {}
+    size = 1 << shift
+    for base, buckets in ranges:
+        _attribute_range(weights, functions, base, size, buckets)
+    return weights
+
+
+def _attribute_range(weights, functions, base, size, buckets):
+    for index, hits in enumerate(buckets):
+        if not hits:
+            continue
+        start = base + index * size
+        end = start + size
+        covered = []
+        for addr, length, name in functions:
+            lo, hi = max(start, addr), min(end, addr + length)
+            if lo < hi:
+                covered.append((hi - lo, name))
+        total = sum(n for n, _ in covered)
+        if not total:
+            name = "<0x%08X-0x%08X>" % (start, end - 1)
+            weights[name] = weights.get(name, 0.0) + hits
+            continue
+        for n, name in covered:
+            weights[name] = weights.get(name, 0.0) + hits * n / float(total)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("elf")
+    parser.add_argument("dump")
+    parser.add_argument("--top", type=int, default=20)
+    args = parser.parse_args()
+
+    ranges, shift, samples, outside = read_histogram(args.dump)
+    weights = attribute(run_functions(Elf32(args.elf)), ranges, shift)
+    counted = sum(sum(buckets) for _base, buckets in ranges)
+
+    print("%d samples, %d outside %s, %d byte buckets"
+          % (samples, outside,
+             " and ".join("0x%08X-0x%08X" % (base, base + (len(buckets) << shift) - 1)
+                          for base, buckets in ranges if buckets),
+             1 << shift))
+    warn_outside(samples, outside)
+    if not counted:
+        return
+    for name, hits in sorted(weights.items(), key=lambda item: -item[1])[:args.top]:
+        print("%6.2f%% %8.1f  %s" % (100.0 * hits / counted, hits, name))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Decode the COBS framed binary telemetry of Telemetry.c.
+
+usage: telemetry.py CAPTURE.bin
+       telemetry.py --elf APP.out --ram RAM.bin [--base 0x20000000]
+
+CAPTURE.bin holds the bytes read from the UART0 virtual COM port (the
+TELEMETRY_SINK_UART0 sink). With --elf, RAM.bin is a dump of the SRAM starting
+at --base and the frames are read from the g_Telemetry_Memory ring of the
+TELEMETRY_SINK_MEMORY sink, oldest first.
+
+Each frame is COBS encoded and ended by a 0x00 byte. Decoded, it is the record
+type (uint8), a sequence number (uint8), the cycle counter (uint32), the
+payload and the CRC-16/CCITT-FALSE of all that (uint16), little endian.
+
+The functions can be imported to decode a live stream, see Decoder.
+"""
+
+import argparse
+import os
+import struct
+import sys
+from collections import namedtuple
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elf32 import Elf32  # noqa: E402
+
+HEADER = struct.Struct("<BBI")
+CRC_SIZE = 2
+
+COUNTERS, PROFILE, EVENT, TEXT = range(1, 5)
+USER = 0x80
+TYPE_NAMES = {COUNTERS: "COUNTERS", PROFILE: "PROFILE", EVENT: "EVENT", TEXT: "TEXT"}
+
+# Probe IDs of Profiler_ProbeIdType and event IDs of main.c
+PROBE_NAMES = {0: "SysTick_Handler", 1: "NVIC_SetPriorityIRQ"}
+EVENT_NAMES = {1: "SW2 pressed", 2: "SW2 dropped"}
+
+Record = namedtuple("Record", "type sequence timestamp payload")
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE, the same as Crc_Crc16()."""
+    for byte in bytearray(data):
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(frame):
+    """Decode one frame without its delimiter, None if it is malformed."""
+    frame = bytearray(frame)
+    out = bytearray()
+    pos = 0
+    while pos < len(frame):
+        code = frame[pos]
+        end = pos + code
+        if code == 0 or end > len(frame):
+            return None
+        out += frame[pos + 1:end]
+        pos = end
+        if code != 0xFF and pos < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def parse_frame(frame):
+    """Record of one COBS frame, or None if it is malformed or fails the CRC."""
+    raw = cobs_decode(frame)
+    if raw is None or len(raw) < HEADER.size + CRC_SIZE:
+        return None
+    (crc,) = struct.unpack_from("<H", raw, len(raw) - CRC_SIZE)
+    if crc16(raw[:-CRC_SIZE]) != crc:
+        return None
+    type_, sequence, timestamp = HEADER.unpack_from(raw)
+    return Record(type_, sequence, timestamp, raw[HEADER.size:-CRC_SIZE])
+
+
+class Decoder(object):
+    """Incremental decoder: feed() the bytes as they arrive, get the records.
+
+    Bad frames and sequence gaps are counted, the decoder resynchronizes on the
+    next delimiter.
+    """
+
+    def __init__(self):
+        self.pending = bytearray()
+        self.bad_frames = 0
+        self.lost_frames = 0
+        self.next_sequence = None
+
+    def feed(self, data):
+        self.pending += data
+        while True:
+            end = self.pending.find(b"\0")
+            if end < 0:
+                return
+            frame = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if not frame:
+                continue
+            record = parse_frame(frame)
+            if record is None:
+                self.bad_frames += 1
+                continue
+            if self.next_sequence is not None:
+                self.lost_frames += (record.sequence - self.next_sequence) & 0xFF
+            self.next_sequence = (record.sequence + 1) & 0xFF
+            yield record
+
+
+def format_payload(record):
+    payload = record.payload
+    if record.type == COUNTERS and len(payload) % 4 == 0:
+        return " ".join(str(v) for v in struct.unpack("<%dI" % (len(payload) // 4), payload))
+    if record.type == PROFILE and len(payload) == 17:
+        count, low, high, mean = struct.unpack_from("<IIII", payload, 1)
+        name = PROBE_NAMES.get(payload[0], "probe %d" % payload[0])
+        return "%s count=%u min=%u max=%u mean=%u" % (name, count, low, high, mean)
+    if record.type == EVENT and len(payload) == 8:
+        event, value = struct.unpack("<II", payload)
+        return "%s value=%u" % (EVENT_NAMES.get(event, "event %d" % event), value)
+    if record.type == TEXT:
+        return payload.decode("ascii", "replace")
+    return payload.hex()
+
+
+def format_record(record, clock_hz):
+    name = TYPE_NAMES.get(record.type)
+    if name is None:
+        name = "USER+%d" % (record.type - USER) if record.type >= USER else "TYPE%d" % record.type
+    return "%12.6f #%03u %-8s %s" % (record.timestamp / float(clock_hz), record.sequence, name,
+                                     format_payload(record))
+
+
+def memory_ring(elf_path, ram_path, base):
+    """Bytes of g_Telemetry_Memory from a RAM dump, oldest first."""
+    symbols = dict((s.name, s) for s in Elf32(elf_path).symbols())
+    for name in ("g_Telemetry_Memory", "g_Telemetry_MemoryHead"):
+        if name not in symbols:
+            raise SystemExit("%s: no %s symbol" % (elf_path, name))
+    with open(ram_path, "rb") as f:
+        ram = f.read()
+    ring_sym = symbols["g_Telemetry_Memory"]
+    head_sym = symbols["g_Telemetry_MemoryHead"]
+    ring = ram[ring_sym.value - base:ring_sym.value - base + ring_sym.size]
+    (head,) = struct.unpack_from("<I", ram, head_sym.value - base)
+    if len(ring) != ring_sym.size or head >= len(ring):
+        raise SystemExit("%s: does not hold the telemetry ring" % ram_path)
+    # The frame at the head may be partly overwritten, the decoder drops it
+    return ring[head:] + ring[:head]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("capture", help="UART capture, or the RAM dump with --elf")
+    parser.add_argument("--elf", help="application image, to read the memory sink from a RAM dump")
+    parser.add_argument("--base", type=lambda v: int(v, 0), default=0x20000000, help="address of the dump")
+    parser.add_argument("--clock", type=float, default=16e6, help="cycle counter frequency in Hz")
+    args = parser.parse_args()
+
+    if args.elf:
+        data = memory_ring(args.elf, args.capture, args.base)
+    else:
+        with open(args.capture, "rb") as f:
+            data = f.read()
+
+    decoder = Decoder()
+    for record in decoder.feed(data):
+        print(format_record(record, args.clock))
+    print("bad frames: %d, lost frames: %d" % (decoder.bad_frames, decoder.lost_frames), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Convert a Trace control block dump to Chrome/Perfetto trace JSON.
+
+usage: trace2perfetto.py DUMP.bin [-o trace.json]
+
+DUMP.bin is a raw memory dump that contains g_Trace. The control block is
+located by its "TRCE" magic, the layout is Trace_ControlBlockType in Trace.h.
+Open the output in ui.perfetto.dev or chrome://tracing.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x45435254
+HEADER = struct.Struct("<IIIIIIII")
+
+ISR_ENTER, ISR_EXIT, TASK_SWITCH, CALLBACK_ENTER, CALLBACK_EXIT, MARKER, IRQ_ENABLE, IRQ_DISABLE = range(1, 9)
+
+EXCEPTION_NAMES = {
+    2: "NMI", 3: "HardFault", 4: "MemManage", 5: "BusFault", 6: "UsageFault",
+    11: "SVCall", 12: "DebugMon", 14: "PendSV", 15: "SysTick",
+    16 + 5: "UART0", 16 + 30: "GPIOPortF",
+}
+
+PID = 1
+TID_THREAD = 1
+TID_HANDLER = 2
+
+
+def exception_name(number):
+    if number in EXCEPTION_NAMES:
+        return EXCEPTION_NAMES[number]
+    if number >= 16:
+        return "IRQ %d" % (number - 16)
+    return "Exception %d" % number
+
+
+def varint(data, pos):
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def read_records(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    offset = data.find(struct.pack("<I", MAGIC))
+    if offset < 0:
+        raise SystemExit("%s: no Trace control block found" % path)
+    _magic, size, freq, write, read, read_ts, _last_ts, dropped = HEADER.unpack_from(data, offset)
+    ring = data[offset + HEADER.size:offset + HEADER.size + size]
+    used = (write - read) & 0xFFFFFFFF
+    # unroll the ring so the records can be decoded linearly
+    linear = bytes(ring[(read + i) % size] for i in range(used))
+
+    records = []
+    pos = 0
+    cycles = read_ts
+    while pos < len(linear):
+        event = linear[pos]
+        delta, pos = varint(linear, pos + 1)
+        arg, pos = varint(linear, pos)
+        cycles += delta
+        records.append((cycles, event, arg))
+    return records, freq, dropped
+
+
+def convert(records, freq):
+    events = [
+        {"ph": "M", "pid": PID, "name": "process_name", "args": {"name": "TM4C123GH6PM"}},
+        {"ph": "M", "pid": PID, "tid": TID_THREAD, "name": "thread_name", "args": {"name": "Thread mode"}},
+        {"ph": "M", "pid": PID, "tid": TID_HANDLER, "name": "thread_name", "args": {"name": "Handler mode"}},
+    ]
+    start = records[0][0] if records else 0
+    task = None
+    for cycles, event, arg in records:
+        ts = (cycles - start) * 1e6 / freq
+        base = {"pid": PID, "ts": ts}
+        if event in (ISR_ENTER, ISR_EXIT):
+            base.update(ph="B" if event == ISR_ENTER else "E", tid=TID_HANDLER, name=exception_name(arg))
+        elif event in (CALLBACK_ENTER, CALLBACK_EXIT):
+            base.update(ph="B" if event == CALLBACK_ENTER else "E", tid=TID_HANDLER,
+                        name=exception_name(arg) + " callback")
+        elif event == TASK_SWITCH:
+            if task is not None:
+                events.append({"pid": PID, "ts": ts, "ph": "E", "tid": TID_THREAD, "name": task})
+            task = "Task %d" % arg
+            base.update(ph="B", tid=TID_THREAD, name=task)
+        elif event == MARKER:
+            base.update(ph="i", s="t", tid=TID_THREAD, name="Marker %d" % arg)
+        elif event in (IRQ_ENABLE, IRQ_DISABLE):
+            base.update(ph="i", s="t", tid=TID_THREAD,
+                        name=("Enable " if event == IRQ_ENABLE else "Disable ") + exception_name(arg + 16))
+        else:
+            base.update(ph="i", s="t", tid=TID_THREAD, name="Unknown event %d" % event, args={"arg": arg})
+        events.append(base)
+    return events
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("dump")
+    parser.add_argument("-o", "--output", default="-")
+    args = parser.parse_args()
+
+    records, freq, dropped = read_records(args.dump)
+    trace = {"traceEvents": convert(records, freq), "displayTimeUnit": "ns",
+             "otherData": {"records": len(records), "dropped": dropped}}
+    if dropped:
+        sys.stderr.write("warning: %d records were dropped on target\n" % dropped)
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    json.dump(trace, out, indent=1)
+    out.write("\n")
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()